@@ -19,15 +19,36 @@ set(use_sse4_2 $<BOOL:${GDJ_USE_SSE4_2}>)
 
 set(is_double_precision $<BOOL:${GDJ_DOUBLE_PRECISION}>)
 set(is_cross_deterministic $<BOOL:${GDJ_CROSS_PLATFORM_DETERMINISTIC}>)
+set(use_external_profile $<BOOL:${GDJ_EXTERNAL_PROFILE}>)
 
 set(is_msvc_cl $<CXX_COMPILER_ID:MSVC>)
 
 set(dev_definitions
 	$<${is_msvc_cl}:JPH_FLOATING_POINT_EXCEPTIONS_ENABLED>
-	JPH_PROFILE_ENABLED
+	$<$<NOT:${use_external_profile}>:JPH_PROFILE_ENABLED>
 	JPH_DEBUG_RENDERER
 )
 
+set(cxxflags "")
+
+if(DEFINED ENV{CXXFLAGS})
+	set(cxxflags "${cxxflags} $ENV{CXXFLAGS}")
+endif()
+
+# HACK(mihe): Jolt doesn't provide a CMake option for its external profiler, so we have to sneak the
+# definition in through the compiler flags instead.
+if(GDJ_EXTERNAL_PROFILE)
+	if(MSVC)
+		set(cxxflags "${cxxflags} /DJPH_EXTERNAL_PROFILE")
+	else()
+		set(cxxflags "${cxxflags} -DJPH_EXTERNAL_PROFILE")
+	endif()
+
+	set(profiler_in_debug_and_release FALSE)
+else()
+	set(profiler_in_debug_and_release TRUE)
+endif()
+
 if(ANDROID)
 	set(override_cxx_flags_arg -DOVERRIDE_CXX_FLAGS=FALSE)
 else()
@@ -54,10 +75,13 @@ gdj_add_external_library(jolt "${configurations}"
 		$<${use_sse4_2}:JPH_USE_SSE4_1>
 		$<${is_double_precision}:JPH_DOUBLE_PRECISION>
 		$<${is_cross_deterministic}:JPH_CROSS_PLATFORM_DETERMINISTIC>
+		$<${use_external_profile}:JPH_EXTERNAL_PROFILE>
 	COMPILE_DEFINITIONS_DEBUG
 		${dev_definitions}
 	COMPILE_DEFINITIONS_RELEASE
 		${dev_definitions}
+	ENVIRONMENT
+		CXXFLAGS=${cxxflags}
 	CMAKE_CACHE_ARGS
 		-DENABLE_ALL_WARNINGS=FALSE
 		-DTARGET_HELLO_WORLD=FALSE
@@ -78,6 +102,7 @@ gdj_add_external_library(jolt "${configurations}"
 		-DUSE_STATIC_MSVC_RUNTIME_LIBRARY=${GDJ_STATIC_RUNTIME_LIBRARY}
 		-DDOUBLE_PRECISION=${GDJ_DOUBLE_PRECISION}
 		-DCROSS_PLATFORM_DETERMINISTIC=${GDJ_CROSS_PLATFORM_DETERMINISTIC}
+		-DPROFILER_IN_DEBUG_AND_RELEASE=${profiler_in_debug_and_release}
 		${override_cxx_flags_arg}
 	LIBRARY_CONFIG_DEBUG Debug
 	LIBRARY_CONFIG_DEVELOPMENT Release
@@ -38,6 +38,11 @@ set(GDJ_CROSS_PLATFORM_DETERMINISTIC FALSE
 	"Compile Jolt with cross-platform determinism. Causes performance loss."
 )
 
+set(GDJ_EXTERNAL_PROFILE FALSE
+	CACHE BOOL
+	"Compile Jolt with its profile zones routed to Godot Jolt's own profiler."
+)
+
 if(NOT APPLE AND NOT ANDROID)
 	set(GDJ_X86_INSTRUCTION_SET SSE2
 		CACHE STRING
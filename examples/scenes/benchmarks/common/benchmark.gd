@@ -0,0 +1,120 @@
+class_name PhysicsBenchmark extends Node3D
+
+# Base for the benchmark scenes. Creates a ground, lets the scene set up whatever it wants to
+# measure, steps the space manually a fixed number of times and prints the step time. Scenes only
+# need to override `_setup` and whichever of the other virtual methods they care about.
+
+const STEP := 1.0 / 60.0
+
+@export_range(0, 600, 1, "or_greater")
+var warmup_steps := 60
+
+@export_range(1, 6000, 1, "or_greater")
+var measured_steps := 600
+
+var _shapes: Array[RID] = []
+var _bodies: Array[RID] = []
+
+func _ready() -> void:
+	var space := get_world_3d().space
+
+	PhysicsServer3D.space_set_active(space, false)
+
+	_create_ground(space)
+	_setup(space)
+
+	_run.call_deferred(space)
+
+func _exit_tree() -> void:
+	for body in _bodies:
+		PhysicsServer3D.free_rid(body)
+
+	for shape in _shapes:
+		PhysicsServer3D.free_rid(shape)
+
+# Creates the bodies and shapes that are to be stepped
+func _setup(_space: RID) -> void:
+	pass
+
+# Returns the half extent of the ground along the X and Z axes
+func _get_ground_extent() -> float:
+	return 100.0
+
+# Called after the warmup steps, right before the measured steps
+func _measure_started(_space: RID) -> void:
+	pass
+
+# Called after every step, as part of the measured step time
+func _step_finished(_space: RID) -> void:
+	pass
+
+# Prints anything describing the setup, before the step times
+func _print_setup(_space: RID) -> void:
+	pass
+
+# Prints any other results, after the step times
+func _print_results(_space: RID) -> void:
+	pass
+
+func _create_box_shape(half_extents: Vector3) -> RID:
+	var shape := PhysicsServer3D.box_shape_create()
+	PhysicsServer3D.shape_set_data(shape, half_extents)
+
+	_shapes.append(shape)
+
+	return shape
+
+func _add_body(space: RID, body: RID, body_position: Vector3) -> void:
+	PhysicsServer3D.body_set_space(body, space)
+	PhysicsServer3D.body_set_state(
+		body,
+		PhysicsServer3D.BODY_STATE_TRANSFORM,
+		Transform3D(Basis(), body_position)
+	)
+
+	_bodies.append(body)
+
+func _create_ground(space: RID) -> void:
+	var extent := _get_ground_extent()
+	var shape := _create_box_shape(Vector3(extent, 0.5, extent))
+
+	var ground := PhysicsServer3D.body_create()
+	PhysicsServer3D.body_set_mode(ground, PhysicsServer3D.BODY_MODE_STATIC)
+	PhysicsServer3D.body_add_shape(ground, shape)
+
+	_add_body(space, ground, Vector3(0.0, -0.5, 0.0))
+
+func _run(space: RID) -> void:
+	for i in warmup_steps:
+		_step(space)
+
+	_measure_started(space)
+
+	var step_times := PackedFloat64Array()
+
+	for i in measured_steps:
+		var start := Time.get_ticks_usec()
+		_step(space)
+		step_times.append(Time.get_ticks_usec() - start)
+
+	step_times.sort()
+
+	var total_usec := 0.0
+
+	for step_time in step_times:
+		total_usec += step_time
+
+	print("Bodies: %d" % _bodies.size())
+	_print_setup(space)
+	print("Step time (mean): %.3f ms" % (total_usec / measured_steps / 1000.0))
+	print("Step time (median): %.3f ms" % (step_times[measured_steps / 2] / 1000.0))
+	print("Step time (p95): %.3f ms" % (step_times[int(measured_steps * 0.95)] / 1000.0))
+	_print_results(space)
+
+	get_tree().quit()
+
+func _step(space: RID) -> void:
+	JoltPhysicsServer3D.space_step(space, STEP)
+	JoltPhysicsServer3D.space_flush_queries(space)
+
+	_step_finished(space)
@@ -0,0 +1,100 @@
+extends PhysicsBenchmark
+
+# Steps a number of compound bodies, each made up of a large number of box shapes, that are resting
+# on the ground and on each other, while reporting their contacts and casting rays against them, and
+# prints the step time. Every reported contact and query result has to map the Jolt sub-shape back
+# to its shape index, which is what this is meant to measure. Run this on two different builds to
+# compare them.
+
+@export_range(1, 64, 1, "or_greater")
+var bodies_per_axis := 6
+
+@export_range(1, 16, 1, "or_greater")
+var shapes_per_axis := 6
+
+@export_range(1, 16, 1, "or_greater")
+var shape_layers := 4
+
+@export_range(0, 1024, 1, "or_greater")
+var max_contacts_reported := 256
+
+@export_range(0, 128, 1, "or_greater")
+var rays_per_axis := 24
+
+var _box_shape := RID()
+var _shape_count := 0
+
+func _get_compound_size() -> Vector3:
+	return Vector3(shapes_per_axis, shape_layers, shapes_per_axis) * 0.5
+
+func _get_ground_extent() -> float:
+	return bodies_per_axis * _get_compound_size().x
+
+func _setup(space: RID) -> void:
+	_box_shape = _create_box_shape(Vector3(0.25, 0.25, 0.25))
+
+	var size := _get_compound_size()
+	var offset := (bodies_per_axis - 1) * size.x * 0.5
+
+	# Two layers of compounds, where the top one is offset by half a compound, so that every body is
+	# touching several others, on top of the ground
+	for layer in 2:
+		var layer_offset := size.x * 0.5 * layer
+
+		for x in bodies_per_axis - layer:
+			for z in bodies_per_axis - layer:
+				var body_position := Vector3(
+					x * size.x - offset + layer_offset,
+					size.y * (layer + 0.5),
+					z * size.z - offset + layer_offset
+				)
+
+				_create_compound(space, body_position)
+
+func _create_compound(space: RID, body_position: Vector3) -> void:
+	var body := PhysicsServer3D.body_create()
+	PhysicsServer3D.body_set_mode(body, PhysicsServer3D.BODY_MODE_RIGID)
+	PhysicsServer3D.body_set_max_contacts_reported(body, max_contacts_reported)
+
+	var shape_offset := (_get_compound_size() - Vector3(0.5, 0.5, 0.5)) * 0.5
+
+	for y in shape_layers:
+		for x in shapes_per_axis:
+			for z in shapes_per_axis:
+				var shape_position := Vector3(x, y, z) * 0.5 - shape_offset
+				var shape_transform := Transform3D(Basis(), shape_position)
+				PhysicsServer3D.body_add_shape(body, _box_shape, shape_transform)
+				_shape_count += 1
+
+	_add_body(space, body, body_position)
+
+func _step_finished(space: RID) -> void:
+	_read_contacts()
+	_cast_rays(space)
+
+func _print_setup(_space: RID) -> void:
+	print("Shapes: %d" % _shape_count)
+
+func _read_contacts() -> void:
+	# Skip the ground, which doesn't report any contacts
+	for i in range(1, _bodies.size()):
+		var state := PhysicsServer3D.body_get_direct_state(_bodies[i])
+
+		for j in state.get_contact_count():
+			state.get_contact_local_shape(j)
+			state.get_contact_collider_shape(j)
+
+func _cast_rays(space: RID) -> void:
+	var space_state := PhysicsServer3D.space_get_direct_state(space)
+	var extent := bodies_per_axis * _get_compound_size().x * 0.5
+	var query := PhysicsRayQueryParameters3D.new()
+
+	for x in rays_per_axis:
+		for z in rays_per_axis:
+			var ray_x := lerpf(-extent, extent, (x + 0.5) / rays_per_axis)
+			var ray_z := lerpf(-extent, extent, (z + 0.5) / rays_per_axis)
+
+			query.from = Vector3(ray_x, 100.0, ray_z)
+			query.to = Vector3(ray_x, -1.0, ray_z)
+
+			space_state.intersect_ray(query)
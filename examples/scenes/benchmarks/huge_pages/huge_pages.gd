@@ -0,0 +1,68 @@
+extends PhysicsBenchmark
+
+# Steps a large number of boxes spread out over a big area a fixed number of times and prints the
+# step time, along with how much of the process's memory is backed by transparent huge pages. Run
+# this once with "Use Huge Pages" disabled and once with it enabled to compare the two. TLB misses
+# can't be read from within the engine, so to compare those, run the project under something like
+# `perf stat -e dTLB-loads,dTLB-load-misses,dTLB-stores,dTLB-store-misses`.
+
+@export_range(1, 128, 1, "or_greater")
+var boxes_per_axis := 30
+
+@export_range(1, 64, 1, "or_greater")
+var layer_count := 10
+
+@export_range(1.0, 10.0, 0.1, "or_greater")
+var spacing := 4.0
+
+func _get_ground_extent() -> float:
+	return boxes_per_axis * spacing
+
+func _setup(space: RID) -> void:
+	var box_shape := _create_box_shape(Vector3(0.5, 0.5, 0.5))
+	var offset := (boxes_per_axis - 1) * spacing * 0.5
+
+	# The boxes are spread out and created in a shuffled order, so that bodies that end up next to
+	# each other in the world are far apart in memory, which is what causes the TLB misses.
+	var positions: Array[Vector3] = []
+
+	for y in layer_count:
+		for x in boxes_per_axis:
+			for z in boxes_per_axis:
+				var x_position := x * spacing - offset
+				var y_position := 0.5 + y * 1.05
+				var z_position := z * spacing - offset
+
+				positions.append(Vector3(x_position, y_position, z_position))
+
+	seed(1234)
+	positions.shuffle()
+
+	for box_position in positions:
+		var body := PhysicsServer3D.body_create()
+		PhysicsServer3D.body_set_mode(body, PhysicsServer3D.BODY_MODE_RIGID)
+		PhysicsServer3D.body_add_shape(body, box_shape)
+
+		_add_body(space, body, box_position)
+
+func _print_setup(space: RID) -> void:
+	var space_stats := JoltPhysicsServer3D.space_get_stats(space)
+	var huge_pages: bool = ProjectSettings.get_setting("physics/jolt_3d/memory/use_huge_pages")
+
+	print("Huge pages: %s" % ("enabled" if huge_pages else "disabled"))
+	print("Transparent huge pages in use: %s" % _get_anon_huge_pages())
+	print("Temporary memory peak: %.2f MiB" % (space_stats["temp_memory_peak"] / 1048576.0))
+
+func _get_anon_huge_pages() -> String:
+	var file := FileAccess.open("/proc/self/smaps_rollup", FileAccess.READ)
+
+	if file == null:
+		return "unknown"
+
+	while not file.eof_reached():
+		var line := file.get_line()
+
+		if line.begins_with("AnonHugePages:"):
+			return line.trim_prefix("AnonHugePages:").strip_edges()
+
+	return "unknown"
@@ -0,0 +1,52 @@
+extends PhysicsBenchmark
+
+# Steps the same pile of boxes a fixed number of times and prints the step time along with the
+# scheduling overhead of the job system. Run this once with "Job System Threads" set to "Worker
+# Thread Pool" and once with it set to "Dedicated Threads" to compare the two.
+
+@export_range(1, 64, 1, "or_greater")
+var boxes_per_axis := 20
+
+@export_range(1, 64, 1, "or_greater")
+var layer_count := 10
+
+var _stats_before := {}
+
+func _get_ground_extent() -> float:
+	return 200.0
+
+func _setup(space: RID) -> void:
+	var box_shape := _create_box_shape(Vector3(0.5, 0.5, 0.5))
+	var offset := (boxes_per_axis - 1) * 0.55
+
+	for y in layer_count:
+		for x in boxes_per_axis:
+			for z in boxes_per_axis:
+				var body := PhysicsServer3D.body_create()
+				PhysicsServer3D.body_set_mode(body, PhysicsServer3D.BODY_MODE_RIGID)
+				PhysicsServer3D.body_add_shape(body, box_shape)
+
+				_add_body(space, body, Vector3(x * 1.1 - offset, 0.5 + y * 1.05, z * 1.1 - offset))
+
+func _measure_started(_space: RID) -> void:
+	_stats_before = JoltPhysicsServer3D.get_job_system_stats()
+
+func _print_setup(_space: RID) -> void:
+	var stats := JoltPhysicsServer3D.get_job_system_stats()
+	var threads := "dedicated threads" if stats["dedicated_threads"] else "worker thread pool"
+
+	print("Job system: %s (%d threads)" % [threads, stats["thread_count"]])
+
+func _print_results(_space: RID) -> void:
+	var stats_after := JoltPhysicsServer3D.get_job_system_stats()
+
+	var job_count: int = stats_after["queued_jobs"] - _stats_before["queued_jobs"]
+	var queue_usec: float = stats_after["queue_time_usec"] - _stats_before["queue_time_usec"]
+	var idle_usec: float = stats_after["wait_idle_usec"] - _stats_before["wait_idle_usec"]
+	var helping_usec: float = stats_after["wait_helping_usec"] - _stats_before["wait_helping_usec"]
+
+	print("Jobs per step: %.1f" % (float(job_count) / measured_steps))
+	print("Queue overhead per step: %.3f ms" % (queue_usec / measured_steps / 1000.0))
+	print("Queue overhead per job: %.3f us" % (queue_usec / maxi(job_count, 1)))
+	print("Waiting idle per step: %.3f ms" % (idle_usec / measured_steps / 1000.0))
+	print("Waiting helping per step: %.3f ms" % (helping_usec / measured_steps / 1000.0))
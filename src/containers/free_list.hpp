@@ -5,8 +5,11 @@ class FreeList {
 	using Implementation = JPH::FixedSizeFreeList<TElement>;
 
 public:
-	explicit FreeList(int32_t p_max_elements) {
-		impl.Init((JPH::uint)p_max_elements, (JPH::uint)p_max_elements);
+	explicit FreeList(int32_t p_max_elements)
+		: FreeList(p_max_elements, p_max_elements) { }
+
+	FreeList(int32_t p_max_elements, int32_t p_page_size) {
+		impl.Init((JPH::uint)p_max_elements, (JPH::uint)p_page_size);
 	}
 
 	template<typename... TParams>
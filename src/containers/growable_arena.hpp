@@ -0,0 +1,170 @@
+#pragma once
+
+// Arena that hands out storage for elements in blocks to each thread, growing as needed, and which
+// can only be freed all at once. Elements are never reused until `destruct_all` is called, which
+// means construction never has to wait for other threads to free anything.
+template<typename TElement>
+class GrowableArena {
+	struct Slot {
+		alignas(TElement) std::byte storage[sizeof(TElement)];
+
+		bool constructed = false;
+	};
+
+	struct Cache {
+		uint64_t generation = 0;
+
+		uint32_t next_index = 0;
+
+		uint32_t end_index = 0;
+	};
+
+	// Page N holds `FIRST_PAGE_SIZE << N` slots, which lets us grow without ever moving anything
+	static constexpr uint32_t FIRST_PAGE_SIZE = 64;
+
+	static constexpr int32_t MAX_PAGES = 24;
+
+	// How many slots each thread reserves for itself at a time
+	static constexpr uint32_t BLOCK_SIZE = 16;
+
+public:
+	GrowableArena()
+		: generation(next_generation++) { }
+
+	GrowableArena(const GrowableArena& p_other) = delete;
+
+	GrowableArena(GrowableArena&& p_other) = delete;
+
+	~GrowableArena() {
+		destruct_all();
+
+		for (std::atomic<Slot*>& page : pages) {
+			delete[] page.load(std::memory_order_relaxed);
+		}
+	}
+
+	template<typename... TParams>
+	TElement* construct(TParams&&... p_params) {
+		const uint64_t current_generation = generation.load(std::memory_order_relaxed);
+
+		// Generations are unique across all arenas, so a matching one also means it's our cache
+		if (cache.generation != current_generation || cache.next_index == cache.end_index) {
+			cache.generation = current_generation;
+			cache.next_index = cursor.fetch_add(BLOCK_SIZE, std::memory_order_relaxed);
+			cache.end_index = cache.next_index + BLOCK_SIZE;
+		}
+
+		Slot* slot = _get_slot(cache.next_index++);
+		ERR_FAIL_NULL_V(slot, nullptr);
+
+		slot->constructed = true;
+
+		return new (slot->storage) TElement(std::forward<TParams>(p_params)...);
+	}
+
+	// Must not be called while any other thread is constructing elements. Returns the number of
+	// elements that were destructed.
+	int32_t destruct_all() {
+		const uint32_t end_index = cursor.load(std::memory_order_acquire);
+
+		int32_t count = 0;
+
+		for (int32_t page_index = 0; page_index < MAX_PAGES; ++page_index) {
+			Slot* page = pages[page_index].load(std::memory_order_acquire);
+
+			if (page == nullptr) {
+				break;
+			}
+
+			const uint32_t page_start = _get_page_start(page_index);
+
+			if (page_start >= end_index) {
+				break;
+			}
+
+			const uint32_t page_end = MIN(page_start + _get_page_size(page_index), end_index);
+
+			for (uint32_t i = 0; i < page_end - page_start; ++i) {
+				Slot& slot = page[i];
+
+				if (slot.constructed) {
+					std::launder(reinterpret_cast<TElement*>(slot.storage))->~TElement();
+					slot.constructed = false;
+					count++;
+				}
+			}
+		}
+
+		cursor.store(0, std::memory_order_relaxed);
+
+		// Any blocks still sitting in thread caches are now invalid
+		generation = next_generation++;
+
+		return count;
+	}
+
+	uint32_t get_capacity() const { return capacity; }
+
+	GrowableArena& operator=(const GrowableArena& p_other) = delete;
+
+	GrowableArena& operator=(GrowableArena&& p_other) = delete;
+
+private:
+	static uint32_t _get_page_size(int32_t p_page_index) {
+		return FIRST_PAGE_SIZE << p_page_index;
+	}
+
+	static uint32_t _get_page_start(int32_t p_page_index) {
+		return FIRST_PAGE_SIZE * ((1U << p_page_index) - 1);
+	}
+
+	static int32_t _get_page_index(uint32_t p_index) {
+		return 31 - (int32_t)JPH::CountLeadingZeros(p_index / FIRST_PAGE_SIZE + 1);
+	}
+
+	Slot* _get_slot(uint32_t p_index) {
+		const int32_t page_index = _get_page_index(p_index);
+
+		ERR_FAIL_COND_V_MSG(
+			page_index >= MAX_PAGES,
+			nullptr,
+			"Arena exceeded its maximum number of elements. This should not happen."
+		);
+
+		Slot* page = pages[page_index].load(std::memory_order_acquire);
+
+		if (page == nullptr) {
+			page = _allocate_page(page_index);
+		}
+
+		return &page[p_index - _get_page_start(page_index)];
+	}
+
+	Slot* _allocate_page(int32_t p_page_index) {
+		const std::lock_guard growth_lock(growth_mutex);
+
+		Slot* page = pages[p_page_index].load(std::memory_order_relaxed);
+
+		if (page == nullptr) {
+			page = new Slot[_get_page_size(p_page_index)];
+			pages[p_page_index].store(page, std::memory_order_release);
+			capacity += _get_page_size(p_page_index);
+		}
+
+		return page;
+	}
+
+	inline static thread_local Cache cache;
+
+	inline static std::atomic<uint64_t> next_generation = 1;
+
+	std::atomic<Slot*> pages[MAX_PAGES] = {};
+
+	std::mutex growth_mutex;
+
+	std::atomic<uint32_t> cursor = 0;
+
+	std::atomic<uint32_t> capacity = 0;
+
+	std::atomic<uint64_t> generation = 0;
+};
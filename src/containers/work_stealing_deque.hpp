@@ -0,0 +1,101 @@
+#pragma once
+
+// Fixed-size Chase-Lev deque, where the owning thread pushes and pops at the bottom while any other
+// thread can steal from the top. Based on "Correct and Efficient Work-Stealing for Weak Memory
+// Models" by Lê et al.
+template<typename TElement, int32_t TCapacity>
+class WorkStealingDeque {
+	static_assert((TCapacity & (TCapacity - 1)) == 0, "Capacity must be a power of two.");
+
+	static_assert(std::is_trivially_copyable_v<TElement>, "Element must be trivially copyable.");
+
+	static constexpr int64_t MASK = TCapacity - 1;
+
+public:
+	// Must only be called from the owning thread. Returns false if the deque is full.
+	bool push(TElement p_element) {
+		const int64_t bottom = bottom_index.load(std::memory_order_relaxed);
+		const int64_t top = top_index.load(std::memory_order_acquire);
+
+		if (bottom - top >= TCapacity) {
+			return false;
+		}
+
+		elements[bottom & MASK].store(p_element, std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_release);
+
+		bottom_index.store(bottom + 1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	// Must only be called from the owning thread
+	bool pop(TElement& p_element) {
+		const int64_t bottom = bottom_index.load(std::memory_order_relaxed) - 1;
+
+		bottom_index.store(bottom, std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		int64_t top = top_index.load(std::memory_order_relaxed);
+
+		if (top > bottom) {
+			bottom_index.store(bottom + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		p_element = elements[bottom & MASK].load(std::memory_order_relaxed);
+
+		if (top != bottom) {
+			return true;
+		}
+
+		// This was the last element, so we race any thieves for it
+		const bool won = top_index.compare_exchange_strong(
+			top,
+			top + 1,
+			std::memory_order_seq_cst,
+			std::memory_order_relaxed
+		);
+
+		bottom_index.store(bottom + 1, std::memory_order_relaxed);
+
+		return won;
+	}
+
+	// Can be called from any thread
+	bool steal(TElement& p_element) {
+		int64_t top = top_index.load(std::memory_order_acquire);
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		const int64_t bottom = bottom_index.load(std::memory_order_acquire);
+
+		if (top >= bottom) {
+			return false;
+		}
+
+		p_element = elements[top & MASK].load(std::memory_order_relaxed);
+
+		return top_index.compare_exchange_strong(
+			top,
+			top + 1,
+			std::memory_order_seq_cst,
+			std::memory_order_relaxed
+		);
+	}
+
+	bool is_empty() const {
+		const int64_t top = top_index.load(std::memory_order_relaxed);
+		const int64_t bottom = bottom_index.load(std::memory_order_relaxed);
+		return top >= bottom;
+	}
+
+private:
+	std::atomic<TElement> elements[TCapacity] = {};
+
+	alignas(64) std::atomic<int64_t> top_index = 0;
+
+	alignas(64) std::atomic<int64_t> bottom_index = 0;
+};
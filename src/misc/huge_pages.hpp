@@ -0,0 +1,92 @@
+#pragma once
+
+#include "misc/utility_functions.hpp"
+
+// We only ever deal in 2 MiB huge pages, since that's the size used by transparent huge pages, and
+// request that size explicitly from hugetlbfs, since its default size can differ between systems.
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+#if defined(__linux__) && !defined(MAP_HUGE_2MB)
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif // defined(__linux__) && !defined(MAP_HUGE_2MB)
+
+// Advises the kernel to back whatever part of the given range covers entire huge pages with
+// transparent huge pages, which leaves the memory itself untouched and is a no-op elsewhere.
+_FORCE_INLINE_ void advise_huge_pages(
+	[[maybe_unused]] void* p_ptr,
+	[[maybe_unused]] size_t p_size
+) {
+#ifdef __linux__
+	const uintptr_t begin = align_up((uintptr_t)p_ptr, HUGE_PAGE_SIZE);
+	const uintptr_t end = ((uintptr_t)p_ptr + p_size) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1);
+
+	if (begin < end) {
+		madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+	}
+#endif // __linux__
+}
+
+// Maps memory that's meant to be backed by huge pages, preferring explicit ones from hugetlbfs and
+// falling back to transparent ones. Returns null if neither is supported, in which case the caller
+// is expected to fall back to a regular allocation.
+_FORCE_INLINE_ void* allocate_huge_pages(
+	[[maybe_unused]] size_t p_size,
+	[[maybe_unused]] size_t& p_mapped_size
+) {
+#ifdef __linux__
+	const size_t size = align_up(p_size, HUGE_PAGE_SIZE);
+
+	constexpr int protection = PROT_READ | PROT_WRITE;
+	constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+	// Explicit huge pages need to have been reserved by the system ahead of time, so this will fail
+	// on most machines, but it guarantees huge pages when it doesn't.
+	void* ptr = mmap(nullptr, size, protection, flags | MAP_HUGETLB | MAP_HUGE_2MB, -1, 0);
+
+	if (ptr != MAP_FAILED) {
+		p_mapped_size = size;
+		return ptr;
+	}
+
+	// Transparent huge pages can only be used for aligned ranges, which `mmap` doesn't guarantee,
+	// so we map an extra huge page worth of memory and unmap whatever ends up outside of it.
+	const size_t padded_size = size + HUGE_PAGE_SIZE;
+
+	ptr = mmap(nullptr, padded_size, protection, flags, -1, 0);
+
+	if (ptr == MAP_FAILED) {
+		return nullptr;
+	}
+
+	const auto padded_begin = (uintptr_t)ptr;
+	const uintptr_t padded_end = padded_begin + padded_size;
+	const uintptr_t begin = align_up(padded_begin, HUGE_PAGE_SIZE);
+	const uintptr_t end = begin + size;
+
+	if (begin > padded_begin) {
+		munmap(ptr, begin - padded_begin);
+	}
+
+	if (padded_end > end) {
+		munmap(reinterpret_cast<void*>(end), padded_end - end);
+	}
+
+	// This can fail if transparent huge pages are disabled, but the memory is still usable then
+	madvise(reinterpret_cast<void*>(begin), size, MADV_HUGEPAGE);
+
+	p_mapped_size = size;
+
+	return reinterpret_cast<void*>(begin);
+#else // __linux__
+	return nullptr;
+#endif // __linux__
+}
+
+_FORCE_INLINE_ void free_huge_pages(
+	[[maybe_unused]] void* p_ptr,
+	[[maybe_unused]] size_t p_mapped_size
+) {
+#ifdef __linux__
+	munmap(p_ptr, p_mapped_size);
+#endif // __linux__
+}
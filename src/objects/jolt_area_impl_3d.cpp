@@ -187,7 +187,10 @@ void JoltAreaImpl3D::set_body_monitor_callback(const Callable& p_callback) {
 
 	body_monitor_callback = p_callback;
 
-	_body_monitoring_changed();
+	// Any events go to the batched callback instead, so nothing changes as far as it's concerned
+	if (!has_batched_monitor_callback()) {
+		_body_monitoring_changed();
+	}
 }
 
 void JoltAreaImpl3D::set_area_monitor_callback(const Callable& p_callback) {
@@ -197,9 +200,65 @@ void JoltAreaImpl3D::set_area_monitor_callback(const Callable& p_callback) {
 
 	area_monitor_callback = p_callback;
 
+	// Any events go to the batched callback instead, so nothing changes as far as it's concerned
+	if (!has_batched_monitor_callback()) {
+		_area_monitoring_changed();
+	}
+}
+
+void JoltAreaImpl3D::set_batched_monitor_callback(const Callable& p_callback) {
+	if (p_callback == batched_monitor_callback) {
+		return;
+	}
+
+	batched_monitor_callback = p_callback;
+
+	_body_monitoring_changed();
 	_area_monitoring_changed();
 }
 
+bool JoltAreaImpl3D::is_monitoring_bodies() const {
+	return has_body_monitor_callback() || has_batched_monitor_callback();
+}
+
+bool JoltAreaImpl3D::is_monitoring_areas() const {
+	return has_area_monitor_callback() || has_batched_monitor_callback();
+}
+
+void JoltAreaImpl3D::set_monitor_mode(MonitorMode p_mode) {
+	if (p_mode == monitor_mode) {
+		return;
+	}
+
+	// The overlaps tracked so far can't be carried over to the new mode, so we have them all be
+	// exited using the current mode, and then reported again once we're back in the space
+	if (space != nullptr) {
+		_reset_space();
+	}
+
+	monitor_mode = p_mode;
+
+	_monitor_mode_changed();
+}
+
+int32_t JoltAreaImpl3D::get_overlap_count() const {
+	if (monitor_mode == JoltPhysicsServer3D::AREA_MONITOR_MODE_OCCUPANCY) {
+		return occupancy_count;
+	}
+
+	int32_t count = 0;
+
+	for (const auto& [id, overlap] : bodies_by_id) {
+		count += overlap.is_empty() ? 0 : 1;
+	}
+
+	for (const auto& [id, overlap] : areas_by_id) {
+		count += overlap.is_empty() ? 0 : 1;
+	}
+
+	return count;
+}
+
 void JoltAreaImpl3D::set_monitorable(bool p_monitorable) {
 	if (p_monitorable == monitorable) {
 		return;
@@ -312,9 +371,14 @@ void JoltAreaImpl3D::body_shape_entered(
 	const JPH::SubShapeID& p_other_shape_id,
 	const JPH::SubShapeID& p_self_shape_id
 ) {
+	if (monitor_mode == JoltPhysicsServer3D::AREA_MONITOR_MODE_OCCUPANCY) {
+		occupancy_count++;
+		return;
+	}
+
 	Overlap& overlap = bodies_by_id[p_body_id];
 
-	if (overlap.shape_pairs.is_empty()) {
+	if (overlap.is_empty()) {
 		_notify_body_entered(p_body_id);
 	}
 
@@ -326,6 +390,10 @@ bool JoltAreaImpl3D::body_shape_exited(
 	const JPH::SubShapeID& p_other_shape_id,
 	const JPH::SubShapeID& p_self_shape_id
 ) {
+	if (monitor_mode == JoltPhysicsServer3D::AREA_MONITOR_MODE_OCCUPANCY) {
+		return _remove_occupant();
+	}
+
 	Overlap* overlap = bodies_by_id.getptr(p_body_id);
 
 	if (overlap == nullptr) {
@@ -336,8 +404,13 @@ bool JoltAreaImpl3D::body_shape_exited(
 		return false;
 	}
 
-	if (overlap->shape_pairs.is_empty()) {
+	if (overlap->is_empty()) {
 		_notify_body_exited(p_body_id);
+
+		// There are no pending events to flush when monitoring bodies, so we can drop it right away
+		if (monitor_mode == JoltPhysicsServer3D::AREA_MONITOR_MODE_BODIES) {
+			bodies_by_id.erase(p_body_id);
+		}
 	}
 
 	return true;
@@ -348,6 +421,11 @@ void JoltAreaImpl3D::area_shape_entered(
 	const JPH::SubShapeID& p_other_shape_id,
 	const JPH::SubShapeID& p_self_shape_id
 ) {
+	if (monitor_mode == JoltPhysicsServer3D::AREA_MONITOR_MODE_OCCUPANCY) {
+		occupancy_count++;
+		return;
+	}
+
 	_add_shape_pair(areas_by_id[p_body_id], p_body_id, p_other_shape_id, p_self_shape_id);
 }
 
@@ -356,13 +434,25 @@ bool JoltAreaImpl3D::area_shape_exited(
 	const JPH::SubShapeID& p_other_shape_id,
 	const JPH::SubShapeID& p_self_shape_id
 ) {
+	if (monitor_mode == JoltPhysicsServer3D::AREA_MONITOR_MODE_OCCUPANCY) {
+		return _remove_occupant();
+	}
+
 	Overlap* overlap = areas_by_id.getptr(p_body_id);
 
 	if (overlap == nullptr) {
 		return false;
 	}
 
-	return _remove_shape_pair(*overlap, p_other_shape_id, p_self_shape_id);
+	if (!_remove_shape_pair(*overlap, p_other_shape_id, p_self_shape_id)) {
+		return false;
+	}
+
+	if (overlap->is_empty() && monitor_mode == JoltPhysicsServer3D::AREA_MONITOR_MODE_BODIES) {
+		areas_by_id.erase(p_body_id);
+	}
+
+	return true;
 }
 
 bool JoltAreaImpl3D::shape_exited(
@@ -375,8 +465,14 @@ bool JoltAreaImpl3D::shape_exited(
 }
 
 void JoltAreaImpl3D::call_queries([[maybe_unused]] JPH::Body& p_jolt_body) {
-	_flush_events(bodies_by_id, body_monitor_callback);
-	_flush_events(areas_by_id, area_monitor_callback);
+	call_queries_enqueued = false;
+
+	if (has_batched_monitor_callback()) {
+		_flush_batched_events();
+	} else {
+		_flush_events(bodies_by_id, body_monitor_callback);
+		_flush_events(areas_by_id, area_monitor_callback);
+	}
 }
 
 JPH::BroadPhaseLayer JoltAreaImpl3D::_get_broad_phase_layer() const {
@@ -431,7 +527,7 @@ void JoltAreaImpl3D::_add_to_space() {
 
 	jolt_id = body->GetID();
 
-	body_iface.AddBody(jolt_id, JPH::EActivation::Activate);
+	space->add_body(jolt_id);
 }
 
 void JoltAreaImpl3D::_add_shape_pair(
@@ -440,6 +536,11 @@ void JoltAreaImpl3D::_add_shape_pair(
 	const JPH::SubShapeID& p_other_shape_id,
 	const JPH::SubShapeID& p_self_shape_id
 ) {
+	if (monitor_mode == JoltPhysicsServer3D::AREA_MONITOR_MODE_BODIES) {
+		p_overlap.shape_pair_count++;
+		return;
+	}
+
 	const JoltReadableBody3D other_jolt_body = space->read_body(p_body_id);
 	const JoltShapedObjectImpl3D* other_object = other_jolt_body.as_shaped();
 	ERR_FAIL_NULL(other_object);
@@ -453,6 +554,8 @@ void JoltAreaImpl3D::_add_shape_pair(
 	shape_indices.self = find_shape_index(p_self_shape_id);
 
 	p_overlap.pending_added.push_back(shape_indices);
+
+	_enqueue_call_queries();
 }
 
 bool JoltAreaImpl3D::_remove_shape_pair(
@@ -460,6 +563,16 @@ bool JoltAreaImpl3D::_remove_shape_pair(
 	const JPH::SubShapeID& p_other_shape_id,
 	const JPH::SubShapeID& p_self_shape_id
 ) {
+	if (monitor_mode == JoltPhysicsServer3D::AREA_MONITOR_MODE_BODIES) {
+		if (p_overlap.shape_pair_count == 0) {
+			return false;
+		}
+
+		p_overlap.shape_pair_count--;
+
+		return true;
+	}
+
 	auto shape_pair = p_overlap.shape_pairs.find({p_other_shape_id, p_self_shape_id});
 
 	if (shape_pair == p_overlap.shape_pairs.end()) {
@@ -469,44 +582,103 @@ bool JoltAreaImpl3D::_remove_shape_pair(
 	p_overlap.pending_removed.push_back(shape_pair->second);
 	p_overlap.shape_pairs.remove(shape_pair);
 
+	_enqueue_call_queries();
+
 	return true;
 }
 
-void JoltAreaImpl3D::_flush_events(OverlapsById& p_objects, const Callable& p_callback) {
+bool JoltAreaImpl3D::_remove_occupant() {
+	if (occupancy_count == 0) {
+		return false;
+	}
+
+	occupancy_count--;
+
+	return true;
+}
+
+template<typename TCallback>
+void JoltAreaImpl3D::_consume_events(OverlapsById& p_objects, TCallback&& p_callback) {
 	p_objects.erase_if([&](auto& p_pair) {
 		auto& [id, overlap] = p_pair;
 
-		if (p_callback.is_valid()) {
-			for (auto& shape_indices : overlap.pending_removed) {
-				_report_event(
-					p_callback,
-					PhysicsServer3D::AREA_BODY_REMOVED,
-					overlap.rid,
-					overlap.instance_id,
-					shape_indices.other,
-					shape_indices.self
-				);
-			}
+		for (const ShapeIndexPair& shape_indices : overlap.pending_removed) {
+			p_callback(PhysicsServer3D::AREA_BODY_REMOVED, overlap, shape_indices);
+		}
 
-			for (auto& shape_indices : overlap.pending_added) {
-				_report_event(
-					p_callback,
-					PhysicsServer3D::AREA_BODY_ADDED,
-					overlap.rid,
-					overlap.instance_id,
-					shape_indices.other,
-					shape_indices.self
-				);
-			}
+		for (const ShapeIndexPair& shape_indices : overlap.pending_added) {
+			p_callback(PhysicsServer3D::AREA_BODY_ADDED, overlap, shape_indices);
 		}
 
 		overlap.pending_removed.clear();
 		overlap.pending_added.clear();
 
-		return overlap.shape_pairs.is_empty();
+		return overlap.is_empty();
 	});
 }
 
+void JoltAreaImpl3D::_flush_events(OverlapsById& p_objects, const Callable& p_callback) {
+	const bool has_callback = p_callback.is_valid();
+
+	const auto report_event = [&](PhysicsServer3D::AreaBodyStatus p_status,
+								  const Overlap& p_overlap,
+								  const ShapeIndexPair& p_shape_indices) {
+		if (has_callback) {
+			_report_event(
+				p_callback,
+				p_status,
+				p_overlap.rid,
+				p_overlap.instance_id,
+				p_shape_indices.other,
+				p_shape_indices.self
+			);
+		}
+	};
+
+	_consume_events(p_objects, report_event);
+}
+
+PackedInt64Array JoltAreaImpl3D::_pack_events(OverlapsById& p_objects) {
+	LocalVector<int64_t> events;
+
+	// Each event is laid out the same way as the arguments of the regular monitor callbacks
+	const auto append_event = [&](PhysicsServer3D::AreaBodyStatus p_status,
+								  const Overlap& p_overlap,
+								  const ShapeIndexPair& p_shape_indices) {
+		events.push_back((int64_t)p_status);
+		events.push_back(p_overlap.rid.get_id());
+		events.push_back((int64_t)(uint64_t)p_overlap.instance_id);
+		events.push_back(p_shape_indices.other);
+		events.push_back(p_shape_indices.self);
+	};
+
+	_consume_events(p_objects, append_event);
+
+	PackedInt64Array packed_events;
+
+	if (!events.is_empty()) {
+		packed_events.resize(events.size());
+		memcpy(packed_events.ptrw(), events.ptr(), (size_t)events.size() * sizeof(int64_t));
+	}
+
+	return packed_events;
+}
+
+void JoltAreaImpl3D::_flush_batched_events() {
+	const PackedInt64Array body_events = _pack_events(bodies_by_id);
+	const PackedInt64Array area_events = _pack_events(areas_by_id);
+
+	if (body_events.is_empty() && area_events.is_empty()) {
+		return;
+	}
+
+	Array arguments;
+	arguments.append(body_events);
+	arguments.append(area_events);
+
+	batched_monitor_callback.callv(arguments);
+}
+
 void JoltAreaImpl3D::_report_event(
 	const Callable& p_callback,
 	PhysicsServer3D::AreaBodyStatus p_status,
@@ -556,6 +728,8 @@ void JoltAreaImpl3D::_force_bodies_entered() {
 			body.pending_added.push_back(index_pair);
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_force_bodies_exited(bool p_remove) {
@@ -566,9 +740,12 @@ void JoltAreaImpl3D::_force_bodies_exited(bool p_remove) {
 
 		if (p_remove) {
 			body.shape_pairs.clear();
+			body.shape_pair_count = 0;
 			_notify_body_exited(id);
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_force_areas_entered() {
@@ -577,6 +754,8 @@ void JoltAreaImpl3D::_force_areas_entered() {
 			area.pending_added.push_back(index_pair);
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_force_areas_exited(bool p_remove) {
@@ -587,8 +766,21 @@ void JoltAreaImpl3D::_force_areas_exited(bool p_remove) {
 
 		if (p_remove) {
 			area.shape_pairs.clear();
+			area.shape_pair_count = 0;
 		}
 	}
+
+	_enqueue_call_queries();
+}
+
+void JoltAreaImpl3D::_enqueue_call_queries() {
+	if (call_queries_enqueued || space == nullptr || jolt_id.IsInvalid()) {
+		return;
+	}
+
+	call_queries_enqueued = true;
+
+	space->enqueue_call_queries(*this);
 }
 
 void JoltAreaImpl3D::_update_group_filter() {
@@ -618,18 +810,25 @@ void JoltAreaImpl3D::_space_changing() {
 		// and as such cannot report any exits, so we're forced to do it manually instead.
 		_force_bodies_exited(true);
 		_force_areas_exited(true);
+
+		occupancy_count = 0;
 	}
 }
 
 void JoltAreaImpl3D::_space_changed() {
 	JoltShapedObjectImpl3D::_space_changed();
 
+	// Any events that were enqueued in the previous space will never be flushed, so we need to
+	// enqueue ourselves again in the new one.
+	call_queries_enqueued = false;
+	_enqueue_call_queries();
+
 	_update_group_filter();
 	_update_default_gravity();
 }
 
 void JoltAreaImpl3D::_body_monitoring_changed() {
-	if (has_body_monitor_callback()) {
+	if (is_monitoring_bodies()) {
 		_force_bodies_entered();
 	} else {
 		_force_bodies_exited(false);
@@ -637,7 +836,7 @@ void JoltAreaImpl3D::_body_monitoring_changed() {
 }
 
 void JoltAreaImpl3D::_area_monitoring_changed() {
-	if (has_area_monitor_callback()) {
+	if (is_monitoring_areas()) {
 		_force_areas_entered();
 	} else {
 		_force_areas_exited(false);
@@ -651,3 +850,22 @@ void JoltAreaImpl3D::_monitorable_changed() {
 void JoltAreaImpl3D::_gravity_changed() {
 	_update_default_gravity();
 }
+
+void JoltAreaImpl3D::_monitor_mode_changed() {
+	if (monitor_mode != JoltPhysicsServer3D::AREA_MONITOR_MODE_OCCUPANCY) {
+		return;
+	}
+
+	if (gravity_mode != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED ||
+		linear_damp_mode != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED ||
+		angular_damp_mode != PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED)
+	{
+		WARN_PRINT(vformat(
+			"Area '%s' overrides gravity or damping while using the occupancy monitor mode. "
+			"Areas using this mode don't keep track of which bodies they overlap, "
+			"and as such can't apply any overrides to them. "
+			"Any such overrides will be ignored.",
+			to_string()
+		));
+	}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "objects/jolt_shaped_object_impl_3d.hpp"
+#include "servers/jolt_physics_server_3d.hpp"
 
 class JoltBodyImpl3D;
 class JoltSoftBodyImpl3D;
@@ -39,6 +40,8 @@ class JoltAreaImpl3D final : public JoltShapedObjectImpl3D {
 	};
 
 	struct Overlap {
+		bool is_empty() const { return shape_pairs.is_empty() && shape_pair_count == 0; }
+
 		HashMap<ShapeIDPair, ShapeIndexPair, ShapeIDPair> shape_pairs;
 
 		InlineVector<ShapeIndexPair, 1> pending_added;
@@ -48,6 +51,9 @@ class JoltAreaImpl3D final : public JoltShapedObjectImpl3D {
 		RID rid;
 
 		ObjectID instance_id;
+
+		// Only used instead of `shape_pairs` when monitoring bodies rather than shapes
+		int32_t shape_pair_count = 0;
 	};
 
 	using OverlapsById = HashMap<JPH::BodyID, Overlap, BodyIDHasher>;
@@ -55,6 +61,8 @@ class JoltAreaImpl3D final : public JoltShapedObjectImpl3D {
 public:
 	using OverrideMode = PhysicsServer3D::AreaSpaceOverrideMode;
 
+	using MonitorMode = JoltPhysicsServer3D::AreaMonitorModeJolt;
+
 	JoltAreaImpl3D();
 
 	bool is_default_area() const;
@@ -75,6 +83,20 @@ public:
 
 	void set_area_monitor_callback(const Callable& p_callback);
 
+	bool has_batched_monitor_callback() const { return batched_monitor_callback.is_valid(); }
+
+	void set_batched_monitor_callback(const Callable& p_callback);
+
+	bool is_monitoring_bodies() const;
+
+	bool is_monitoring_areas() const;
+
+	MonitorMode get_monitor_mode() const { return monitor_mode; }
+
+	void set_monitor_mode(MonitorMode p_mode);
+
+	int32_t get_overlap_count() const;
+
 	bool is_monitorable() const { return monitorable; }
 
 	void set_monitorable(bool p_monitorable);
@@ -195,8 +217,17 @@ private:
 		const JPH::SubShapeID& p_self_shape_id
 	);
 
+	template<typename TCallback>
+	void _consume_events(OverlapsById& p_objects, TCallback&& p_callback);
+
+	bool _remove_occupant();
+
 	void _flush_events(OverlapsById& p_objects, const Callable& p_callback);
 
+	PackedInt64Array _pack_events(OverlapsById& p_objects);
+
+	void _flush_batched_events();
+
 	void _report_event(
 		const Callable& p_callback,
 		PhysicsServer3D::AreaBodyStatus p_status,
@@ -218,6 +249,8 @@ private:
 
 	void _force_areas_exited(bool p_remove);
 
+	void _enqueue_call_queries();
+
 	void _update_group_filter();
 
 	void _update_default_gravity();
@@ -234,6 +267,8 @@ private:
 
 	void _gravity_changed();
 
+	void _monitor_mode_changed();
+
 	OverlapsById bodies_by_id;
 
 	OverlapsById areas_by_id;
@@ -244,6 +279,8 @@ private:
 
 	Callable area_monitor_callback;
 
+	Callable batched_monitor_callback;
+
 	float priority = 0.0f;
 
 	float gravity = 9.8f;
@@ -260,7 +297,13 @@ private:
 
 	OverrideMode angular_damp_mode = PhysicsServer3D::AREA_SPACE_OVERRIDE_DISABLED;
 
+	MonitorMode monitor_mode = JoltPhysicsServer3D::AREA_MONITOR_MODE_SHAPES;
+
+	int32_t occupancy_count = 0;
+
 	bool monitorable = false;
 
 	bool point_gravity = false;
+
+	bool call_queries_enqueued = false;
 };
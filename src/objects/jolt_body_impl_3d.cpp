@@ -41,6 +41,89 @@ bool integrate(TValue& p_value, PhysicsServer3D::AreaSpaceOverrideMode p_mode, T
 
 } // namespace
 
+void JoltBodyImpl3D::ContactBuffer::set_capacity(int32_t p_capacity) {
+	depths.resize(p_capacity);
+	shape_indices.resize(p_capacity);
+	collider_shape_indices.resize(p_capacity);
+	collider_ids.resize(p_capacity);
+	collider_rids.resize(p_capacity);
+	normals.resize(p_capacity);
+	positions.resize(p_capacity);
+	collider_positions.resize(p_capacity);
+	velocities.resize(p_capacity);
+	collider_velocities.resize(p_capacity);
+	impulses.resize(p_capacity);
+
+	count = MIN(count, p_capacity);
+}
+
+void JoltBodyImpl3D::ContactBuffer::copy_from(const ContactBuffer& p_other) {
+	set_capacity(p_other.count);
+
+	auto copy = [&](auto& p_dst, const auto& p_src) {
+		std::copy_n(p_src.ptr(), p_other.count, p_dst.ptr());
+	};
+
+	copy(depths, p_other.depths);
+	copy(shape_indices, p_other.shape_indices);
+	copy(collider_shape_indices, p_other.collider_shape_indices);
+	copy(collider_ids, p_other.collider_ids);
+	copy(collider_rids, p_other.collider_rids);
+	copy(normals, p_other.normals);
+	copy(positions, p_other.positions);
+	copy(collider_positions, p_other.collider_positions);
+	copy(velocities, p_other.velocities);
+	copy(collider_velocities, p_other.collider_velocities);
+	copy(impulses, p_other.impulses);
+
+	count = p_other.count;
+}
+
+void JoltBodyImpl3D::ContactBuffer::add(
+	const JoltBodyImpl3D& p_collider,
+	float p_depth,
+	int32_t p_shape_index,
+	int32_t p_collider_shape_index,
+	JPH::Vec3Arg p_normal,
+	JPH::RVec3Arg p_position,
+	JPH::RVec3Arg p_collider_position,
+	JPH::Vec3Arg p_velocity,
+	JPH::Vec3Arg p_collider_velocity,
+	JPH::Vec3Arg p_impulse
+) {
+	const int32_t capacity = get_capacity();
+
+	if (capacity == 0) {
+		return;
+	}
+
+	int32_t index = count;
+
+	if (count < capacity) {
+		count++;
+	} else {
+		const auto shallowest = std::min_element(depths.begin(), depths.end());
+
+		if (*shallowest >= p_depth) {
+			return;
+		}
+
+		index = (int32_t)std::distance(depths.begin(), shallowest);
+	}
+
+	depths[index] = p_depth;
+	shape_indices[index] = p_shape_index;
+	collider_shape_indices[index] = p_collider_shape_index;
+	collider_ids[index] = p_collider.get_instance_id();
+	collider_rids[index] = p_collider.get_rid();
+	normals[index] = p_normal;
+	positions[index] = p_position;
+	collider_positions[index] = p_collider_position;
+	velocities[index] = p_velocity;
+	collider_velocities[index] = p_collider_velocity;
+	impulses[index] = p_impulse;
+}
+
 JoltBodyImpl3D::JoltBodyImpl3D()
 	: JoltShapedObjectImpl3D(OBJECT_TYPE_BODY) { }
 
@@ -208,6 +291,68 @@ void JoltBodyImpl3D::set_param(PhysicsServer3D::BodyParameter p_param, const Var
 	}
 }
 
+double JoltBodyImpl3D::get_jolt_param(JoltParameter p_param) const {
+	switch (p_param) {
+		case JoltPhysicsServer3D::BODY_CONTACT_REPORT_MIN_VELOCITY: {
+			return contact_report_min_velocity;
+		}
+		case JoltPhysicsServer3D::BODY_CONTACT_REPORT_MIN_IMPULSE: {
+			return contact_report_min_impulse;
+		}
+		default: {
+			ERR_FAIL_D_MSG(vformat("Unhandled body parameter: '%d'", p_param));
+		}
+	}
+}
+
+void JoltBodyImpl3D::set_jolt_param(JoltParameter p_param, double p_value) {
+	switch (p_param) {
+		case JoltPhysicsServer3D::BODY_CONTACT_REPORT_MIN_VELOCITY: {
+			contact_report_min_velocity = (float)p_value;
+		} break;
+		case JoltPhysicsServer3D::BODY_CONTACT_REPORT_MIN_IMPULSE: {
+			contact_report_min_impulse = (float)p_value;
+		} break;
+		default: {
+			ERR_FAIL_MSG(vformat("Unhandled body parameter: '%d'", p_param));
+		} break;
+	}
+}
+
+bool JoltBodyImpl3D::get_jolt_flag(JoltFlag p_flag) const {
+	switch (p_flag) {
+		case JoltPhysicsServer3D::BODY_FLAG_ESTIMATE_CONTACT_IMPULSES: {
+			return estimate_contact_impulses;
+		}
+		case JoltPhysicsServer3D::BODY_FLAG_REPORT_ADDED_CONTACTS_ONLY: {
+			return report_added_contacts_only;
+		}
+		case JoltPhysicsServer3D::BODY_FLAG_REPORT_ONE_CONTACT_PER_PAIR: {
+			return report_one_contact_per_pair;
+		}
+		default: {
+			ERR_FAIL_D_MSG(vformat("Unhandled body flag: '%d'", p_flag));
+		}
+	}
+}
+
+void JoltBodyImpl3D::set_jolt_flag(JoltFlag p_flag, bool p_enabled) {
+	switch (p_flag) {
+		case JoltPhysicsServer3D::BODY_FLAG_ESTIMATE_CONTACT_IMPULSES: {
+			estimate_contact_impulses = p_enabled;
+		} break;
+		case JoltPhysicsServer3D::BODY_FLAG_REPORT_ADDED_CONTACTS_ONLY: {
+			report_added_contacts_only = p_enabled;
+		} break;
+		case JoltPhysicsServer3D::BODY_FLAG_REPORT_ONE_CONTACT_PER_PAIR: {
+			report_one_contact_per_pair = p_enabled;
+		} break;
+		default: {
+			ERR_FAIL_MSG(vformat("Unhandled body flag: '%d'", p_flag));
+		} break;
+	}
+}
+
 void JoltBodyImpl3D::set_custom_integrator(bool p_enabled) {
 	if (custom_integrator == p_enabled) {
 		return;
@@ -263,6 +408,13 @@ void JoltBodyImpl3D::set_is_sleeping(bool p_enabled) {
 
 	JPH::BodyInterface& body_iface = space->get_body_iface();
 
+	if (!body_iface.IsAdded(jolt_id)) {
+		// HACK(mihe): Bodies that are still waiting to be added to the space will be activated once
+		// they are, and since `BODY_STATE_TRANSFORM` will be set right after creation it's more or
+		// less impossible to have a body be sleeping when created, so we don't bother storing this.
+		return;
+	}
+
 	if (p_enabled) {
 		body_iface.DeactivateBody(jolt_id);
 	} else {
@@ -468,7 +620,7 @@ void JoltBodyImpl3D::set_center_of_mass_custom(const Vector3& p_center_of_mass)
 }
 
 void JoltBodyImpl3D::set_max_contacts_reported(int32_t p_count) {
-	if (contacts.size() == p_count) {
+	if (contacts.get_capacity() == p_count) {
 		return;
 	}
 
@@ -476,8 +628,7 @@ void JoltBodyImpl3D::set_max_contacts_reported(int32_t p_count) {
 		_contact_reporting_changed();
 	};
 
-	contacts.resize(p_count);
-	contact_count = MIN(contact_count, p_count);
+	contacts.set_capacity(p_count);
 
 	const bool use_manifold_reduction = !reports_contacts();
 
@@ -495,54 +646,19 @@ bool JoltBodyImpl3D::reports_all_kinematic_contacts() const {
 	return reports_contacts() && JoltProjectSettings::report_all_kinematic_contacts();
 }
 
-void JoltBodyImpl3D::add_contact(
-	const JoltBodyImpl3D* p_collider,
-	float p_depth,
-	int32_t p_shape_index,
-	int32_t p_collider_shape_index,
-	const Vector3& p_normal,
-	const Vector3& p_position,
-	const Vector3& p_collider_position,
-	const Vector3& p_velocity,
-	const Vector3& p_collider_velocity,
-	const Vector3& p_impulse
-) {
-	const int32_t max_contacts = get_max_contacts_reported();
-
-	if (max_contacts == 0) {
-		return;
+bool JoltBodyImpl3D::passes_contact_report_thresholds(
+	float p_approach_velocity,
+	float p_normal_impulse
+) const {
+	if (contact_report_min_velocity > 0.0f && p_approach_velocity < contact_report_min_velocity) {
+		return false;
 	}
 
-	Contact* contact = nullptr;
-
-	if (contact_count < max_contacts) {
-		contact = &contacts[contact_count++];
-	} else {
-		auto shallowest = std::min_element(
-			contacts.begin(),
-			contacts.end(),
-			[](const Contact& p_lhs, const Contact& p_rhs) {
-				return p_lhs.depth < p_rhs.depth;
-			}
-		);
-
-		if (shallowest->depth < p_depth) {
-			contact = &*shallowest;
-		}
+	if (contact_report_min_impulse > 0.0f && p_normal_impulse < contact_report_min_impulse) {
+		return false;
 	}
 
-	if (contact != nullptr) {
-		contact->shape_index = p_shape_index;
-		contact->collider_shape_index = p_collider_shape_index;
-		contact->collider_id = p_collider->get_instance_id();
-		contact->collider_rid = p_collider->get_rid();
-		contact->normal = p_normal;
-		contact->position = p_position;
-		contact->collider_position = p_collider_position;
-		contact->velocity = p_velocity;
-		contact->collider_velocity = p_collider_velocity;
-		contact->impulse = p_impulse;
-	}
+	return true;
 }
 
 void JoltBodyImpl3D::reset_mass_properties() {
@@ -828,6 +944,11 @@ void JoltBodyImpl3D::remove_joint(JoltJointImpl3D* p_joint) {
 }
 
 void JoltBodyImpl3D::call_queries([[maybe_unused]] JPH::Body& p_jolt_body) {
+	if (JoltProjectSettings::should_run_on_separate_thread()) {
+		// The step has been joined by now, so we can safely publish what it captured
+		std::swap(snapshot, pending_snapshot);
+	}
+
 	if (!sync_state) {
 		return;
 	}
@@ -888,7 +1009,15 @@ void JoltBodyImpl3D::pre_step(float p_step, JPH::Body& p_jolt_body) {
 		} break;
 	}
 
-	contact_count = 0;
+	contacts.clear();
+}
+
+void JoltBodyImpl3D::post_step(float p_step, JPH::Body& p_jolt_body) {
+	JoltShapedObjectImpl3D::post_step(p_step, p_jolt_body);
+
+	if (JoltProjectSettings::should_run_on_separate_thread()) {
+		_capture_snapshot(p_jolt_body, pending_snapshot);
+	}
 }
 
 void JoltBodyImpl3D::move_kinematic(float p_step, JPH::Body& p_jolt_body) {
@@ -1215,10 +1344,7 @@ void JoltBodyImpl3D::_add_to_space() {
 
 	jolt_id = body->GetID();
 
-	// HACK(mihe): Since `BODY_STATE_TRANSFORM` will be set right after creation it's more or less
-	// impossible to have a body be sleeping when created, so we default to always starting out as
-	// awake/active.
-	body_iface.AddBody(jolt_id, JPH::EActivation::Activate);
+	space->add_body(jolt_id);
 }
 
 void JoltBodyImpl3D::_integrate_forces(float p_step, JPH::Body& p_jolt_body) {
@@ -1253,6 +1379,23 @@ void JoltBodyImpl3D::_pre_step_rigid(float p_step, JPH::Body& p_jolt_body) {
 	_integrate_forces(p_step, p_jolt_body);
 }
 
+void JoltBodyImpl3D::_capture_snapshot(const JPH::Body& p_jolt_body, Snapshot& p_snapshot) const {
+	const Transform3D transform_unscaled = {
+		to_godot(p_jolt_body.GetRotation()),
+		to_godot(p_jolt_body.GetPosition())};
+
+	p_snapshot.transform = transform_unscaled.scaled_local(scale);
+	p_snapshot.center_of_mass = to_godot(p_jolt_body.GetCenterOfMassPosition());
+	p_snapshot.linear_velocity = to_godot(p_jolt_body.GetLinearVelocity());
+	p_snapshot.angular_velocity = to_godot(p_jolt_body.GetAngularVelocity());
+	p_snapshot.gravity = gravity;
+	p_snapshot.total_linear_damp = total_linear_damp;
+	p_snapshot.total_angular_damp = total_angular_damp;
+	p_snapshot.sleeping = !p_jolt_body.IsActive();
+
+	p_snapshot.contacts.copy_from(contacts);
+}
+
 void JoltBodyImpl3D::_pre_step_kinematic(float p_step, JPH::Body& p_jolt_body) {
 	_update_gravity(p_jolt_body);
 
@@ -1505,6 +1648,7 @@ void JoltBodyImpl3D::_mode_changed() {
 	_update_kinematic_transform();
 	_update_mass_properties();
 	wake_up();
+	mark_dirty();
 }
 
 void JoltBodyImpl3D::_shapes_built() {
@@ -1531,6 +1675,14 @@ void JoltBodyImpl3D::_space_changed() {
 	_areas_changed();
 
 	sync_state = false;
+
+	if (space != nullptr && JoltProjectSettings::should_run_on_separate_thread()) {
+		const JoltReadableBody3D jolt_body = space->read_body(jolt_id);
+
+		if (jolt_body.is_valid()) {
+			_capture_snapshot(*jolt_body, snapshot);
+		}
+	}
 }
 
 void JoltBodyImpl3D::_areas_changed() {
@@ -1544,6 +1696,7 @@ void JoltBodyImpl3D::_joints_changed() {
 
 void JoltBodyImpl3D::_transform_changed() {
 	wake_up();
+	mark_dirty();
 }
 
 void JoltBodyImpl3D::_motion_changed() {
@@ -1562,4 +1715,5 @@ void JoltBodyImpl3D::_axis_lock_changed() {
 void JoltBodyImpl3D::_contact_reporting_changed() {
 	_update_possible_kinematic_contacts();
 	wake_up();
+	mark_dirty();
 }
@@ -2,6 +2,7 @@
 
 #include "objects/jolt_physics_direct_body_state_3d.hpp"
 #include "objects/jolt_shaped_object_impl_3d.hpp"
+#include "servers/jolt_physics_server_3d.hpp"
 
 class JoltAreaImpl3D;
 class JoltJointImpl3D;
@@ -11,28 +12,110 @@ class JoltBodyImpl3D final : public JoltShapedObjectImpl3D {
 public:
 	using DampMode = PhysicsServer3D::BodyDampMode;
 
-	struct Contact {
-		float depth = 0.0f;
+	using JoltParameter = JoltPhysicsServer3D::BodyParamJolt;
 
-		int32_t shape_index = 0;
+	using JoltFlag = JoltPhysicsServer3D::BodyFlagJolt;
 
-		int32_t collider_shape_index = 0;
+	// Reported contacts, stored as one array per property and kept in their Jolt representation,
+	// since most of them are never read. They only get converted when read through the direct body
+	// state, one property at a time.
+	class ContactBuffer {
+	public:
+		int32_t get_capacity() const { return (int32_t)depths.size(); }
 
-		ObjectID collider_id;
+		void set_capacity(int32_t p_capacity);
 
-		RID collider_rid;
+		int32_t get_count() const { return count; }
 
-		Vector3 normal;
+		void clear() { count = 0; }
 
-		Vector3 position;
+		void copy_from(const ContactBuffer& p_other);
 
-		Vector3 collider_position;
+		void add(
+			const JoltBodyImpl3D& p_collider,
+			float p_depth,
+			int32_t p_shape_index,
+			int32_t p_collider_shape_index,
+			JPH::Vec3Arg p_normal,
+			JPH::RVec3Arg p_position,
+			JPH::RVec3Arg p_collider_position,
+			JPH::Vec3Arg p_velocity,
+			JPH::Vec3Arg p_collider_velocity,
+			JPH::Vec3Arg p_impulse
+		);
 
-		Vector3 velocity;
+		int32_t get_shape_index(int32_t p_index) const { return shape_indices[p_index]; }
 
-		Vector3 collider_velocity;
+		int32_t get_collider_shape_index(int32_t p_index) const {
+			return collider_shape_indices[p_index];
+		}
 
-		Vector3 impulse;
+		ObjectID get_collider_id(int32_t p_index) const { return collider_ids[p_index]; }
+
+		RID get_collider_rid(int32_t p_index) const { return collider_rids[p_index]; }
+
+		Vector3 get_normal(int32_t p_index) const { return to_godot(normals[p_index]); }
+
+		Vector3 get_position(int32_t p_index) const { return to_godot(positions[p_index]); }
+
+		Vector3 get_collider_position(int32_t p_index) const {
+			return to_godot(collider_positions[p_index]);
+		}
+
+		Vector3 get_velocity(int32_t p_index) const { return to_godot(velocities[p_index]); }
+
+		Vector3 get_collider_velocity(int32_t p_index) const {
+			return to_godot(collider_velocities[p_index]);
+		}
+
+		Vector3 get_impulse(int32_t p_index) const { return to_godot(impulses[p_index]); }
+
+	private:
+		LocalVector<float> depths;
+
+		LocalVector<int32_t> shape_indices;
+
+		LocalVector<int32_t> collider_shape_indices;
+
+		LocalVector<ObjectID> collider_ids;
+
+		LocalVector<RID> collider_rids;
+
+		LocalVector<JPH::Vec3> normals;
+
+		LocalVector<JPH::RVec3> positions;
+
+		LocalVector<JPH::RVec3> collider_positions;
+
+		LocalVector<JPH::Vec3> velocities;
+
+		LocalVector<JPH::Vec3> collider_velocities;
+
+		LocalVector<JPH::Vec3> impulses;
+
+		int32_t count = 0;
+	};
+
+	// State as it was at the end of the last step, which is what gets read through the direct body
+	// state while a step is running on a separate thread.
+	struct Snapshot {
+		ContactBuffer contacts;
+
+		Transform3D transform;
+
+		Vector3 center_of_mass;
+
+		Vector3 linear_velocity;
+
+		Vector3 angular_velocity;
+
+		Vector3 gravity;
+
+		float total_linear_damp = 0.0f;
+
+		float total_angular_damp = 0.0f;
+
+		bool sleeping = false;
 	};
 
 	JoltBodyImpl3D();
@@ -49,6 +132,14 @@ public:
 
 	void set_param(PhysicsServer3D::BodyParameter p_param, const Variant& p_value);
 
+	double get_jolt_param(JoltParameter p_param) const;
+
+	void set_jolt_param(JoltParameter p_param, double p_value);
+
+	bool get_jolt_flag(JoltFlag p_flag) const;
+
+	void set_jolt_flag(JoltFlag p_flag, bool p_enabled);
+
 	bool has_state_sync_callback() const { return body_state_callback.is_valid(); }
 
 	void set_state_sync_callback(const Callable& p_callback) { body_state_callback = p_callback; }
@@ -96,30 +187,60 @@ public:
 
 	void set_center_of_mass_custom(const Vector3& p_center_of_mass);
 
-	int32_t get_max_contacts_reported() const { return contacts.size(); }
+	int32_t get_max_contacts_reported() const { return contacts.get_capacity(); }
 
 	void set_max_contacts_reported(int32_t p_count);
 
-	int32_t get_contact_count() const { return contact_count; }
+	const ContactBuffer& get_contacts() const { return contacts; }
 
-	const Contact& get_contact(int32_t p_index) { return contacts[p_index]; }
-
-	bool reports_contacts() const override { return !contacts.is_empty(); }
+	bool reports_contacts() const override { return contacts.get_capacity() > 0; }
 
 	bool reports_all_kinematic_contacts() const;
 
+	// Whether the impulses of reported contacts should be estimated, which is only the case if
+	// explicitly enabled, if any of them have been read before, or if they're needed for filtering.
+	bool estimates_contact_impulses() const {
+		return estimate_contact_impulses || contact_report_min_impulse > 0.0f ||
+			contact_impulses_requested.load(std::memory_order_relaxed);
+	}
+
+	void request_contact_impulses() {
+		contact_impulses_requested.store(true, std::memory_order_relaxed);
+	}
+
+	bool reports_added_contacts_only() const { return report_added_contacts_only; }
+
+	bool reports_one_contact_per_pair() const { return report_one_contact_per_pair; }
+
+	// Whether a contact manifold is above the minimum approach velocity and normal impulse that
+	// this body has been configured to report, if any.
+	bool passes_contact_report_thresholds(float p_approach_velocity, float p_normal_impulse) const;
+
 	void add_contact(
-		const JoltBodyImpl3D* p_collider,
+		const JoltBodyImpl3D& p_collider,
 		float p_depth,
 		int32_t p_shape_index,
 		int32_t p_collider_shape_index,
-		const Vector3& p_normal,
-		const Vector3& p_position,
-		const Vector3& p_collider_position,
-		const Vector3& p_velocity,
-		const Vector3& p_collider_velocity,
-		const Vector3& p_impulse
-	);
+		JPH::Vec3Arg p_normal,
+		JPH::RVec3Arg p_position,
+		JPH::RVec3Arg p_collider_position,
+		JPH::Vec3Arg p_velocity,
+		JPH::Vec3Arg p_collider_velocity,
+		JPH::Vec3Arg p_impulse
+	) {
+		contacts.add(
+			p_collider,
+			p_depth,
+			p_shape_index,
+			p_collider_shape_index,
+			p_normal,
+			p_position,
+			p_collider_position,
+			p_velocity,
+			p_collider_velocity,
+			p_impulse
+		);
+	}
 
 	void reset_mass_properties();
 
@@ -173,6 +294,10 @@ public:
 
 	void pre_step(float p_step, JPH::Body& p_jolt_body) override;
 
+	void post_step(float p_step, JPH::Body& p_jolt_body) override;
+
+	const Snapshot& get_snapshot() const { return snapshot; }
+
 	void move_kinematic(float p_step, JPH::Body& p_jolt_body);
 
 	JoltPhysicsDirectBodyState3D* get_direct_state();
@@ -270,6 +395,8 @@ private:
 
 	void _pre_step_kinematic(float p_step, JPH::Body& p_jolt_body);
 
+	void _capture_snapshot(const JPH::Body& p_jolt_body, Snapshot& p_snapshot) const;
+
 	JPH::EAllowedDOFs _calculate_allowed_dofs() const;
 
 	JPH::MassProperties _calculate_mass_properties(const JPH::Shape& p_shape) const;
@@ -316,10 +443,14 @@ private:
 
 	LocalVector<RID> exceptions;
 
-	LocalVector<Contact> contacts;
+	ContactBuffer contacts;
 
 	LocalVector<JoltAreaImpl3D*> areas;
 
+	Snapshot snapshot;
+
+	Snapshot pending_snapshot;
+
 	LocalVector<JoltJointImpl3D*> joints;
 
 	Variant custom_integration_userdata;
@@ -366,7 +497,9 @@ private:
 
 	float collision_priority = 1.0f;
 
-	int32_t contact_count = 0;
+	float contact_report_min_velocity = 0.0f;
+
+	float contact_report_min_impulse = 0.0f;
 
 	uint32_t locked_axes = 0;
 
@@ -375,4 +508,12 @@ private:
 	bool custom_center_of_mass = false;
 
 	bool custom_integrator = false;
+
+	bool estimate_contact_impulses = false;
+
+	bool report_added_contacts_only = false;
+
+	bool report_one_contact_per_pair = false;
+
+	std::atomic<bool> contact_impulses_requested = false;
 };
@@ -43,6 +43,7 @@ void JoltObjectImpl3D::set_space(JoltSpace3D* p_space) {
 
 	if (space != nullptr) {
 		_add_to_space();
+		mark_dirty();
 	}
 
 	_space_changed();
@@ -68,13 +69,24 @@ void JoltObjectImpl3D::set_collision_mask(uint32_t p_mask) {
 	_collision_mask_changed();
 }
 
+void JoltObjectImpl3D::mark_dirty() {
+	if (dirty || space == nullptr || jolt_id.IsInvalid()) {
+		return;
+	}
+
+	dirty = true;
+
+	space->enqueue_dirty(*this);
+}
+
 void JoltObjectImpl3D::_remove_from_space() {
 	QUIET_FAIL_COND(jolt_id.IsInvalid());
 
-	space->get_body_iface().RemoveBody(jolt_id);
+	space->remove_body(jolt_id);
 	space->get_body_iface().DestroyBody(jolt_id);
 
 	jolt_id = {};
+	dirty = false;
 }
 
 void JoltObjectImpl3D::_reset_space() {
@@ -83,6 +95,7 @@ void JoltObjectImpl3D::_reset_space() {
 	_space_changing();
 	_remove_from_space();
 	_add_to_space();
+	mark_dirty();
 	_space_changed();
 }
 
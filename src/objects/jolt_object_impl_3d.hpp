@@ -98,6 +98,12 @@ public:
 
 	void set_pickable(bool p_enabled) { pickable = p_enabled; }
 
+	bool is_dirty() const { return dirty; }
+
+	void mark_dirty();
+
+	void clear_dirty() { dirty = false; }
+
 	bool can_collide_with(const JoltObjectImpl3D& p_other) const;
 
 	bool can_interact_with(const JoltObjectImpl3D& p_other) const;
@@ -154,4 +160,6 @@ protected:
 	ObjectType object_type = OBJECT_TYPE_INVALID;
 
 	bool pickable = false;
+
+	bool dirty = false;
 };
@@ -1,84 +1,160 @@
 #include "jolt_physics_direct_body_state_3d.hpp"
 
 #include "objects/jolt_body_impl_3d.hpp"
+#include "servers/jolt_physics_server_3d.hpp"
 #include "spaces/jolt_physics_direct_space_state_3d.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
+namespace {
+
+// While a body's space is being stepped on a separate thread we can't read its live state without
+// racing with the step, so we read the snapshot that was published at the end of the last step.
+const JoltBodyImpl3D::Snapshot* get_snapshot(const JoltBodyImpl3D& p_body) {
+	const JoltSpace3D* space = p_body.get_space();
+	return space != nullptr && space->is_stepping() ? &p_body.get_snapshot() : nullptr;
+}
+
+const JoltBodyImpl3D::ContactBuffer& get_contacts(const JoltBodyImpl3D& p_body) {
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(p_body)) {
+		return snapshot->contacts;
+	}
+
+	return p_body.get_contacts();
+}
+
+int32_t get_contact_count(const JoltBodyImpl3D& p_body) {
+	return get_contacts(p_body).get_count();
+}
+
+// Anything not covered by the snapshot has to wait for the step to finish before touching the body
+void wait_for_step() {
+	static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton())->wait_for_step();
+}
+
+} // namespace
+
 JoltPhysicsDirectBodyState3D::JoltPhysicsDirectBodyState3D(JoltBodyImpl3D* p_body)
 	: body(p_body) { }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_total_gravity() const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		return snapshot->gravity;
+	}
+
 	return body->get_gravity();
 }
 
 double JoltPhysicsDirectBodyState3D::_get_total_angular_damp() const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		return (double)snapshot->total_angular_damp;
+	}
+
 	return (double)body->get_total_angular_damp();
 }
 
 double JoltPhysicsDirectBodyState3D::_get_total_linear_damp() const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		return (double)snapshot->total_linear_damp;
+	}
+
 	return (double)body->get_total_linear_damp();
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_center_of_mass() const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		return snapshot->center_of_mass;
+	}
+
 	return body->get_center_of_mass();
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_center_of_mass_local() const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		return snapshot->transform.xform_inv(snapshot->center_of_mass);
+	}
+
 	return body->get_center_of_mass_local();
 }
 
 Basis JoltPhysicsDirectBodyState3D::_get_principal_inertia_axes() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	wait_for_step();
 	return body->get_principal_inertia_axes();
 }
 
 double JoltPhysicsDirectBodyState3D::_get_inverse_mass() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	wait_for_step();
 	return 1.0 / body->get_mass();
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_inverse_inertia() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	wait_for_step();
 	return body->get_inverse_inertia();
 }
 
 Basis JoltPhysicsDirectBodyState3D::_get_inverse_inertia_tensor() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	wait_for_step();
 	return body->get_inverse_inertia_tensor();
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_linear_velocity() const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		return snapshot->linear_velocity;
+	}
+
 	return body->get_linear_velocity();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_linear_velocity(const Vector3& p_velocity) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->set_linear_velocity(p_velocity);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_angular_velocity() const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		return snapshot->angular_velocity;
+	}
+
 	return body->get_angular_velocity();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_angular_velocity(const Vector3& p_velocity) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->set_angular_velocity(p_velocity);
 }
 
 void JoltPhysicsDirectBodyState3D::_set_transform(const Transform3D& p_transform) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->set_transform(p_transform);
 }
 
 Transform3D JoltPhysicsDirectBodyState3D::_get_transform() const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		return snapshot->transform;
+	}
+
 	return body->get_transform_scaled();
 }
 
@@ -86,11 +162,19 @@ Vector3 JoltPhysicsDirectBodyState3D::_get_velocity_at_local_position(
 	const Vector3& p_local_position
 ) const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		const Vector3 position = snapshot->transform.origin + p_local_position;
+		const Vector3 relative_position = position - snapshot->center_of_mass;
+		return snapshot->linear_velocity + snapshot->angular_velocity.cross(relative_position);
+	}
+
 	return body->get_velocity_at_position(body->get_position() + p_local_position);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_central_impulse(const Vector3& p_impulse) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->apply_central_impulse(p_impulse);
 }
 
@@ -99,31 +183,37 @@ void JoltPhysicsDirectBodyState3D::_apply_impulse(
 	const Vector3& p_position
 ) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->apply_impulse(p_impulse, p_position);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_torque_impulse(const Vector3& p_impulse) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->apply_torque_impulse(p_impulse);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_central_force(const Vector3& p_force) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->apply_central_force(p_force);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_force(const Vector3& p_force, const Vector3& p_position) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->apply_force(p_force, p_position);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_torque(const Vector3& p_torque) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->apply_torque(p_torque);
 }
 
 void JoltPhysicsDirectBodyState3D::_add_constant_central_force(const Vector3& p_force) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->add_constant_central_force(p_force);
 }
 
@@ -132,120 +222,137 @@ void JoltPhysicsDirectBodyState3D::_add_constant_force(
 	const Vector3& p_position
 ) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->add_constant_force(p_force, p_position);
 }
 
 void JoltPhysicsDirectBodyState3D::_add_constant_torque(const Vector3& p_torque) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->add_constant_torque(p_torque);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_constant_force() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	wait_for_step();
 	return body->get_constant_force();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_constant_force(const Vector3& p_force) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->set_constant_force(p_force);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_constant_torque() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	wait_for_step();
 	return body->get_constant_torque();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_constant_torque(const Vector3& p_torque) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	return body->set_constant_torque(p_torque);
 }
 
 bool JoltPhysicsDirectBodyState3D::_is_sleeping() const {
 	QUIET_FAIL_NULL_D_ED(body);
+
+	if (const JoltBodyImpl3D::Snapshot* snapshot = get_snapshot(*body)) {
+		return snapshot->sleeping;
+	}
+
 	return body->is_sleeping();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_sleep_state(bool p_enabled) {
 	QUIET_FAIL_NULL_ED(body);
+	wait_for_step();
 	body->set_is_sleeping(p_enabled);
 }
 
 int32_t JoltPhysicsDirectBodyState3D::_get_contact_count() const {
 	QUIET_FAIL_NULL_D_ED(body);
-	return body->get_contact_count();
+	return get_contact_count(*body);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_local_position(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).position;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return get_contacts(*body).get_position(p_contact_idx);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_local_normal(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).normal;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return get_contacts(*body).get_normal(p_contact_idx);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_impulse(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).impulse;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+
+	// Impulses are only estimated for bodies that have asked for them, starting with the next step
+	body->request_contact_impulses();
+
+	return get_contacts(*body).get_impulse(p_contact_idx);
 }
 
 int32_t JoltPhysicsDirectBodyState3D::_get_contact_local_shape(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).shape_index;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return get_contacts(*body).get_shape_index(p_contact_idx);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_local_velocity_at_position(int32_t p_contact_idx
 ) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).velocity;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return get_contacts(*body).get_velocity(p_contact_idx);
 }
 
 RID JoltPhysicsDirectBodyState3D::_get_contact_collider(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_rid;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return get_contacts(*body).get_collider_rid(p_contact_idx);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_collider_position(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_position;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return get_contacts(*body).get_collider_position(p_contact_idx);
 }
 
 uint64_t JoltPhysicsDirectBodyState3D::_get_contact_collider_id(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_id;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return get_contacts(*body).get_collider_id(p_contact_idx);
 }
 
 Object* JoltPhysicsDirectBodyState3D::_get_contact_collider_object(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return ObjectDB::get_instance(body->get_contact(p_contact_idx).collider_id);
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return ObjectDB::get_instance(get_contacts(*body).get_collider_id(p_contact_idx));
 }
 
 int32_t JoltPhysicsDirectBodyState3D::_get_contact_collider_shape(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_shape_index;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return get_contacts(*body).get_collider_shape_index(p_contact_idx);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_collider_velocity_at_position(
 	int32_t p_contact_idx
 ) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_velocity;
+	ERR_FAIL_INDEX_D(p_contact_idx, get_contact_count(*body));
+	return get_contacts(*body).get_collider_velocity(p_contact_idx);
 }
 
 double JoltPhysicsDirectBodyState3D::_get_step() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	wait_for_step();
 	return (double)body->get_space()->get_last_step();
 }
 
@@ -2,6 +2,7 @@
 
 #include "shapes/jolt_custom_empty_shape.hpp"
 #include "shapes/jolt_shape_impl_3d.hpp"
+#include "spaces/jolt_profiler.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
 JoltShapedObjectImpl3D::JoltShapedObjectImpl3D(ObjectType p_object_type)
@@ -165,6 +166,8 @@ JPH::ShapeRefC JoltShapedObjectImpl3D::try_build_shape() {
 }
 
 JPH::ShapeRefC JoltShapedObjectImpl3D::build_shape() {
+	JOLT_PROFILE_SCOPE("JoltShapedObjectImpl3D::build_shape");
+
 	JPH::ShapeRefC new_shape = try_build_shape();
 
 	if (new_shape == nullptr) {
@@ -192,6 +195,13 @@ void JoltShapedObjectImpl3D::update_shape() {
 
 	space->get_body_iface().SetShape(jolt_id, jolt_shape, false, JPH::EActivation::DontActivate);
 
+	// We need `post_step` to be called on this object, even if it's not active, in order for the
+	// previous shape to be released.
+	mark_dirty();
+
+	// Any area overlaps involving this object might now refer to different shapes
+	space->enqueue_shape_changed(*this);
+
 	_shapes_built();
 }
 
@@ -245,6 +255,13 @@ void JoltShapedObjectImpl3D::clear_shapes() {
 }
 
 int32_t JoltShapedObjectImpl3D::find_shape_index(uint32_t p_shape_instance_id) const {
+	if (!shape_indices.is_empty()) {
+		// IDs below the first one wrap around to something out of range
+		const uint32_t offset = p_shape_instance_id - first_shape_id;
+
+		return offset < (uint32_t)shape_indices.size() ? shape_indices[(int32_t)offset] : -1;
+	}
+
 	return shapes.find_if([&](const JoltShapeInstance3D& p_shape) {
 		return p_shape.get_id() == p_shape_instance_id;
 	});
@@ -346,6 +363,8 @@ void JoltShapedObjectImpl3D::post_step(float p_step, JPH::Body& p_jolt_body) {
 }
 
 void JoltShapedObjectImpl3D::_shapes_changed() {
+	_update_shape_indices();
+
 	update_shape();
 }
 
@@ -359,3 +378,38 @@ void JoltShapedObjectImpl3D::_space_changing() {
 		jolt_settings = new JPH::BodyCreationSettings(body->GetBodyCreationSettings());
 	}
 }
+
+void JoltShapedObjectImpl3D::_update_shape_indices() {
+	shape_indices.clear();
+	first_shape_id = 0;
+
+	if (shapes.is_empty()) {
+		return;
+	}
+
+	uint32_t min_id = UINT32_MAX;
+	uint32_t max_id = 0;
+
+	for (const JoltShapeInstance3D& shape : shapes) {
+		min_id = MIN(min_id, shape.get_id());
+		max_id = MAX(max_id, shape.get_id());
+	}
+
+	// Shapes that get replaced end up with new IDs, leaving gaps in the range, so to keep the table
+	// from growing without bounds we fall back to searching once it's mostly gaps
+	const uint32_t id_range = max_id - min_id + 1;
+	const auto max_id_range = (uint32_t)MAX(shapes.size() * 4, 64);
+
+	if (id_range > max_id_range) {
+		return;
+	}
+
+	shape_indices.resize((int32_t)id_range);
+	std::fill(shape_indices.begin(), shape_indices.end(), -1);
+
+	for (int32_t i = 0; i < shapes.size(); ++i) {
+		shape_indices[(int32_t)(shapes[i].get_id() - min_id)] = i;
+	}
+
+	first_shape_id = min_id;
+}
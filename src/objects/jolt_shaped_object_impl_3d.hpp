@@ -94,4 +94,13 @@ protected:
 	JPH::ShapeRefC previous_jolt_shape;
 
 	JPH::BodyCreationSettings* jolt_settings = new JPH::BodyCreationSettings();
+
+private:
+	void _update_shape_indices();
+
+	// Maps shape instance IDs, relative to `first_shape_id`, to their index in `shapes`, with gaps
+	// holding -1. Left empty when the IDs are too spread out, in which case we search instead.
+	LocalVector<int32_t> shape_indices;
+
+	uint32_t first_shape_id = 0;
 };
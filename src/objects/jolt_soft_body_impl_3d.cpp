@@ -91,6 +91,12 @@ void JoltSoftBodyImpl3D::set_is_sleeping(bool p_enabled) {
 
 	JPH::BodyInterface& body_iface = space->get_body_iface();
 
+	if (!body_iface.IsAdded(jolt_id)) {
+		// HACK(mihe): Bodies that are still waiting to be added to the space will be activated once
+		// they are, so there's nothing to do here.
+		return;
+	}
+
 	if (p_enabled) {
 		body_iface.DeactivateBody(jolt_id);
 	} else {
@@ -486,7 +492,7 @@ void JoltSoftBodyImpl3D::_add_to_space() {
 
 	jolt_id = body->GetID();
 
-	body_iface.AddBody(jolt_id, JPH::EActivation::Activate);
+	space->add_body(jolt_id);
 }
 
 bool JoltSoftBodyImpl3D::_ref_shared_data() {
@@ -17,6 +17,7 @@
 #include <gdextension_interface.h>
 
 #include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/geometry_instance3d.hpp>
 #include <godot_cpp/classes/object.hpp>
 #include <godot_cpp/classes/os.hpp>
@@ -55,7 +56,6 @@
 #include <godot_cpp/classes/editor_plugin.hpp>
 #include <godot_cpp/classes/editor_settings.hpp>
 #include <godot_cpp/classes/engine_debugger.hpp>
-#include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/popup_menu.hpp>
 #include <godot_cpp/classes/standard_material3d.hpp>
 #include <godot_cpp/classes/theme.hpp>
@@ -79,7 +79,8 @@
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/FixedSizeFreeList.h>
 #include <Jolt/Core/IssueReporting.h>
-#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <Jolt/Core/JobSystem.h>
+#include <Jolt/Core/Profiler.h>
 #include <Jolt/Core/TempAllocator.h>
 #include <Jolt/Geometry/ConvexSupport.h>
 #include <Jolt/Geometry/GJKClosestPoint.h>
@@ -136,11 +137,16 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 #include <mutex>
+#include <new>
 #include <thread>
 #include <type_traits>
 #include <unordered_map>
@@ -149,6 +155,12 @@
 #include <variant>
 #include <vector>
 
+#ifdef __linux__
+
+#include <sys/mman.h>
+
+#endif // __linux__
+
 using namespace godot;
 
 #ifdef _MSC_VER
@@ -156,15 +168,18 @@ using namespace godot;
 #endif // _MSC_VER
 
 #include "containers/free_list.hpp"
+#include "containers/growable_arena.hpp"
 #include "containers/hash_map.hpp"
 #include "containers/hash_set.hpp"
 #include "containers/inline_vector.hpp"
 #include "containers/local_vector.hpp"
 #include "containers/rid_owner.hpp"
 #include "containers/symmetric_bit_table.hpp"
+#include "containers/work_stealing_deque.hpp"
 #include "misc/bind_macros.hpp"
 #include "misc/error_macros.hpp"
 #include "misc/gdclass_macros.hpp"
+#include "misc/huge_pages.hpp"
 #include "misc/jolt_stream_wrappers.hpp"
 #include "misc/math.hpp"
 #include "misc/scope_guard.hpp"
@@ -3,3 +3,5 @@
 void jolt_initialize();
 
 void jolt_deinitialize();
+
+void jolt_set_huge_pages_enabled(bool p_enabled);
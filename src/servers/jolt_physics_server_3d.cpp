@@ -9,6 +9,8 @@
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_body_impl_3d.hpp"
 #include "objects/jolt_soft_body_impl_3d.hpp"
+#include "servers/jolt_globals.hpp"
+#include "servers/jolt_project_settings.hpp"
 #include "shapes/jolt_box_shape_impl_3d.hpp"
 #include "shapes/jolt_capsule_shape_impl_3d.hpp"
 #include "shapes/jolt_concave_polygon_shape_impl_3d.hpp"
@@ -20,7 +22,9 @@
 #include "shapes/jolt_world_boundary_shape_impl_3d.hpp"
 #include "spaces/jolt_job_system.hpp"
 #include "spaces/jolt_physics_direct_space_state_3d.hpp"
+#include "spaces/jolt_profiler.hpp"
 #include "spaces/jolt_space_3d.hpp"
+#include "spaces/jolt_temp_allocator_pool.hpp"
 
 void JoltPhysicsServer3D::_bind_methods() {
 #ifdef GDJ_CONFIG_EDITOR
@@ -29,6 +33,40 @@ void JoltPhysicsServer3D::_bind_methods() {
 	BIND_METHOD(JoltPhysicsServer3D, space_dump_debug_snapshot, "space", "dir");
 #endif // GDJ_CONFIG_EDITOR
 
+	BIND_METHOD(JoltPhysicsServer3D, space_get_jolt_param, "space", "param");
+	BIND_METHOD(JoltPhysicsServer3D, space_set_jolt_param, "space", "param", "value");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_get_jolt_flag, "space", "flag");
+	BIND_METHOD(JoltPhysicsServer3D, space_set_jolt_flag, "space", "flag", "value");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_apply_jolt_quality_preset, "space", "preset");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_begin_bulk_add, "space");
+	BIND_METHOD(JoltPhysicsServer3D, space_end_bulk_add, "space");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_get_broad_phase_stats, "space");
+	BIND_METHOD(JoltPhysicsServer3D, space_get_stats, "space");
+
+	BIND_METHOD(JoltPhysicsServer3D, body_get_jolt_param, "body", "param");
+	BIND_METHOD(JoltPhysicsServer3D, body_set_jolt_param, "body", "param", "value");
+
+	BIND_METHOD(JoltPhysicsServer3D, body_get_jolt_flag, "body", "flag");
+	BIND_METHOD(JoltPhysicsServer3D, body_set_jolt_flag, "body", "flag", "value");
+
+	BIND_METHOD(JoltPhysicsServer3D, area_set_batched_monitor_callback, "area", "callback");
+
+	BIND_METHOD(JoltPhysicsServer3D, area_get_jolt_monitor_mode, "area");
+	BIND_METHOD(JoltPhysicsServer3D, area_set_jolt_monitor_mode, "area", "mode");
+	BIND_METHOD(JoltPhysicsServer3D, area_get_jolt_overlap_count, "area");
+
+	BIND_METHOD(JoltPhysicsServer3D, get_job_system_stats);
+	BIND_METHOD(JoltPhysicsServer3D, get_temp_memory_stats);
+
+	BIND_METHOD(JoltPhysicsServer3D, is_profiler_enabled);
+	BIND_METHOD(JoltPhysicsServer3D, set_profiler_enabled, "enabled");
+	BIND_METHOD(JoltPhysicsServer3D, dump_profiler_trace, "frame_count");
+	BIND_METHOD(JoltPhysicsServer3D, write_profiler_trace, "path", "frame_count");
+
 	BIND_METHOD(JoltPhysicsServer3D, joint_get_enabled, "joint");
 	BIND_METHOD(JoltPhysicsServer3D, joint_set_enabled, "joint", "enabled");
 
@@ -76,6 +114,30 @@ void JoltPhysicsServer3D::_bind_methods() {
 	BIND_METHOD(JoltPhysicsServer3D, generic_6dof_joint_get_applied_force, "joint");
 	BIND_METHOD(JoltPhysicsServer3D, generic_6dof_joint_get_applied_torque, "joint");
 
+	BIND_ENUM_CONSTANT(SPACE_COLLISION_STEPS);
+	BIND_ENUM_CONSTANT(SPACE_MAX_COLLISION_STEPS);
+	BIND_ENUM_CONSTANT(SPACE_ADAPTIVE_VELOCITY_THRESHOLD);
+	BIND_ENUM_CONSTANT(SPACE_ADAPTIVE_PENETRATION_THRESHOLD);
+	BIND_ENUM_CONSTANT(SPACE_POSITION_ITERATIONS);
+
+	BIND_ENUM_CONSTANT(SPACE_FLAG_ADAPTIVE_COLLISION_STEPS);
+	BIND_ENUM_CONSTANT(SPACE_FLAG_ALLOW_SLEEPING);
+
+	BIND_ENUM_CONSTANT(SPACE_QUALITY_PRESET_LOW);
+	BIND_ENUM_CONSTANT(SPACE_QUALITY_PRESET_DEFAULT);
+	BIND_ENUM_CONSTANT(SPACE_QUALITY_PRESET_HIGH);
+
+	BIND_ENUM_CONSTANT(BODY_CONTACT_REPORT_MIN_VELOCITY);
+	BIND_ENUM_CONSTANT(BODY_CONTACT_REPORT_MIN_IMPULSE);
+
+	BIND_ENUM_CONSTANT(BODY_FLAG_ESTIMATE_CONTACT_IMPULSES);
+	BIND_ENUM_CONSTANT(BODY_FLAG_REPORT_ADDED_CONTACTS_ONLY);
+	BIND_ENUM_CONSTANT(BODY_FLAG_REPORT_ONE_CONTACT_PER_PAIR);
+
+	BIND_ENUM_CONSTANT(AREA_MONITOR_MODE_SHAPES);
+	BIND_ENUM_CONSTANT(AREA_MONITOR_MODE_BODIES);
+	BIND_ENUM_CONSTANT(AREA_MONITOR_MODE_OCCUPANCY);
+
 	BIND_ENUM_CONSTANT(HINGE_JOINT_LIMIT_SPRING_FREQUENCY);
 	BIND_ENUM_CONSTANT(HINGE_JOINT_LIMIT_SPRING_DAMPING);
 	BIND_ENUM_CONSTANT(HINGE_JOINT_MOTOR_MAX_TORQUE);
@@ -209,6 +271,8 @@ void JoltPhysicsServer3D::_shape_set_data(const RID& p_shape, const Variant& p_d
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
+	wait_for_step();
+
 	shape->set_data(p_data);
 }
 
@@ -216,6 +280,8 @@ void JoltPhysicsServer3D::_shape_set_custom_solver_bias(const RID& p_shape, doub
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
+	wait_for_step();
+
 	shape->set_solver_bias((float)p_bias);
 }
 
@@ -223,6 +289,8 @@ PhysicsServer3D::ShapeType JoltPhysicsServer3D::_shape_get_type(const RID& p_sha
 	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
+	wait_for_step();
+
 	return shape->get_type();
 }
 
@@ -230,6 +298,8 @@ Variant JoltPhysicsServer3D::_shape_get_data(const RID& p_shape) const {
 	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
+	wait_for_step();
+
 	return shape->get_data();
 }
 
@@ -237,6 +307,8 @@ void JoltPhysicsServer3D::_shape_set_margin(const RID& p_shape, double p_margin)
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
+	wait_for_step();
+
 	shape->set_margin((float)p_margin);
 }
 
@@ -244,6 +316,8 @@ double JoltPhysicsServer3D::_shape_get_margin(const RID& p_shape) const {
 	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
+	wait_for_step();
+
 	return (double)shape->get_margin();
 }
 
@@ -251,11 +325,13 @@ double JoltPhysicsServer3D::_shape_get_custom_solver_bias(const RID& p_shape) co
 	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
+	wait_for_step();
+
 	return (double)shape->get_solver_bias();
 }
 
 RID JoltPhysicsServer3D::_space_create() {
-	JoltSpace3D* space = memnew(JoltSpace3D(job_system));
+	JoltSpace3D* space = memnew(JoltSpace3D(job_system, temp_allocator_pool));
 	RID rid = space_owner.make_rid(space);
 	space->set_rid(rid);
 
@@ -272,6 +348,8 @@ void JoltPhysicsServer3D::_space_set_active(const RID& p_space, bool p_active) {
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
 
+	wait_for_step();
+
 	if (p_active) {
 		active_spaces.insert(space);
 	} else {
@@ -283,6 +361,8 @@ bool JoltPhysicsServer3D::_space_is_active(const RID& p_space) const {
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
 
+	wait_for_step();
+
 	return active_spaces.has(space);
 }
 
@@ -294,6 +374,8 @@ void JoltPhysicsServer3D::_space_set_param(
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
 
+	wait_for_step();
+
 	space->set_param(p_param, p_value);
 }
 
@@ -301,6 +383,8 @@ double JoltPhysicsServer3D::_space_get_param(const RID& p_space, SpaceParameter
 	const JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
 
+	wait_for_step();
+
 	return space->get_param(p_param);
 }
 
@@ -308,6 +392,8 @@ PhysicsDirectSpaceState3D* JoltPhysicsServer3D::_space_get_direct_state(const RI
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
 
+	wait_for_step();
+
 	return space->get_direct_state();
 }
 
@@ -315,6 +401,8 @@ void JoltPhysicsServer3D::_space_set_debug_contacts(
 	[[maybe_unused]] const RID& p_space,
 	[[maybe_unused]] int32_t p_max_contacts
 ) {
+	wait_for_step();
+
 #ifdef GDJ_CONFIG_EDITOR
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
@@ -325,6 +413,8 @@ void JoltPhysicsServer3D::_space_set_debug_contacts(
 
 PackedVector3Array JoltPhysicsServer3D::_space_get_contacts([[maybe_unused]] const RID& p_space
 ) const {
+	wait_for_step();
+
 #ifdef GDJ_CONFIG_EDITOR
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
@@ -336,6 +426,8 @@ PackedVector3Array JoltPhysicsServer3D::_space_get_contacts([[maybe_unused]] con
 }
 
 int32_t JoltPhysicsServer3D::_space_get_contact_count([[maybe_unused]] const RID& p_space) const {
+	wait_for_step();
+
 #ifdef GDJ_CONFIG_EDITOR
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
@@ -357,6 +449,8 @@ void JoltPhysicsServer3D::_area_set_space(const RID& p_area, const RID& p_space)
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	JoltSpace3D* space = nullptr;
 
 	if (p_space.is_valid()) {
@@ -371,6 +465,8 @@ RID JoltPhysicsServer3D::_area_get_space(const RID& p_area) const {
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
+	wait_for_step();
+
 	const JoltSpace3D* space = area->get_space();
 
 	if (space == nullptr) {
@@ -389,6 +485,8 @@ void JoltPhysicsServer3D::_area_add_shape(
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
@@ -403,6 +501,8 @@ void JoltPhysicsServer3D::_area_set_shape(
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
@@ -417,6 +517,8 @@ void JoltPhysicsServer3D::_area_set_shape_transform(
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->set_shape_transform(p_shape_idx, p_transform);
 }
 
@@ -424,6 +526,8 @@ int32_t JoltPhysicsServer3D::_area_get_shape_count(const RID& p_area) const {
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
+	wait_for_step();
+
 	return area->get_shape_count();
 }
 
@@ -431,6 +535,8 @@ RID JoltPhysicsServer3D::_area_get_shape(const RID& p_area, int32_t p_shape_idx)
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
+	wait_for_step();
+
 	const JoltShapeImpl3D* shape = area->get_shape(p_shape_idx);
 	ERR_FAIL_NULL_D(shape);
 
@@ -442,6 +548,8 @@ Transform3D JoltPhysicsServer3D::_area_get_shape_transform(const RID& p_area, in
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
+	wait_for_step();
+
 	return area->get_shape_transform_scaled(p_shape_idx);
 }
 
@@ -449,6 +557,8 @@ void JoltPhysicsServer3D::_area_remove_shape(const RID& p_area, int32_t p_shape_
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->remove_shape(p_shape_idx);
 }
 
@@ -456,6 +566,8 @@ void JoltPhysicsServer3D::_area_clear_shapes(const RID& p_area) {
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->clear_shapes();
 }
 
@@ -467,10 +579,14 @@ void JoltPhysicsServer3D::_area_set_shape_disabled(
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->set_shape_disabled(p_shape_idx, p_disabled);
 }
 
 void JoltPhysicsServer3D::_area_attach_object_instance_id(const RID& p_area, uint64_t p_id) {
+	wait_for_step();
+
 	RID area_rid = p_area;
 
 	if (space_owner.owns(area_rid)) {
@@ -485,6 +601,8 @@ void JoltPhysicsServer3D::_area_attach_object_instance_id(const RID& p_area, uin
 }
 
 uint64_t JoltPhysicsServer3D::_area_get_object_instance_id(const RID& p_area) const {
+	wait_for_step();
+
 	RID area_rid = p_area;
 
 	if (space_owner.owns(area_rid)) {
@@ -503,6 +621,8 @@ void JoltPhysicsServer3D::_area_set_param(
 	AreaParameter p_param,
 	const Variant& p_value
 ) {
+	wait_for_step();
+
 	RID area_rid = p_area;
 
 	if (space_owner.owns(area_rid)) {
@@ -520,10 +640,14 @@ void JoltPhysicsServer3D::_area_set_transform(const RID& p_area, const Transform
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	return area->set_transform(p_transform);
 }
 
 Variant JoltPhysicsServer3D::_area_get_param(const RID& p_area, AreaParameter p_param) const {
+	wait_for_step();
+
 	RID area_rid = p_area;
 
 	if (space_owner.owns(area_rid)) {
@@ -541,6 +665,8 @@ Transform3D JoltPhysicsServer3D::_area_get_transform(const RID& p_area) const {
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
+	wait_for_step();
+
 	return area->get_transform_scaled();
 }
 
@@ -548,6 +674,8 @@ void JoltPhysicsServer3D::_area_set_collision_mask(const RID& p_area, uint32_t p
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->set_collision_mask(p_mask);
 }
 
@@ -555,6 +683,8 @@ uint32_t JoltPhysicsServer3D::_area_get_collision_mask(const RID& p_area) const
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
+	wait_for_step();
+
 	return area->get_collision_mask();
 }
 
@@ -562,6 +692,8 @@ void JoltPhysicsServer3D::_area_set_collision_layer(const RID& p_area, uint32_t
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->set_collision_layer(p_layer);
 }
 
@@ -569,6 +701,8 @@ uint32_t JoltPhysicsServer3D::_area_get_collision_layer(const RID& p_area) const
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
+	wait_for_step();
+
 	return area->get_collision_layer();
 }
 
@@ -576,6 +710,8 @@ void JoltPhysicsServer3D::_area_set_monitorable(const RID& p_area, bool p_monito
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->set_monitorable(p_monitorable);
 }
 
@@ -586,6 +722,8 @@ void JoltPhysicsServer3D::_area_set_monitor_callback(
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->set_body_monitor_callback(p_callback);
 }
 
@@ -596,6 +734,8 @@ void JoltPhysicsServer3D::_area_set_area_monitor_callback(
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->set_area_monitor_callback(p_callback);
 }
 
@@ -603,6 +743,8 @@ void JoltPhysicsServer3D::_area_set_ray_pickable(const RID& p_area, bool p_enabl
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
+	wait_for_step();
+
 	area->set_pickable(p_enable);
 }
 
@@ -617,6 +759,8 @@ void JoltPhysicsServer3D::_body_set_space(const RID& p_body, const RID& p_space)
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	JoltSpace3D* space = nullptr;
 
 	if (p_space.is_valid()) {
@@ -631,6 +775,8 @@ RID JoltPhysicsServer3D::_body_get_space(const RID& p_body) const {
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	const JoltSpace3D* space = body->get_space();
 
 	if (space == nullptr) {
@@ -644,6 +790,8 @@ void JoltPhysicsServer3D::_body_set_mode(const RID& p_body, BodyMode p_mode) {
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_mode(p_mode);
 }
 
@@ -651,6 +799,8 @@ PhysicsServer3D::BodyMode JoltPhysicsServer3D::_body_get_mode(const RID& p_body)
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_mode();
 }
 
@@ -663,6 +813,8 @@ void JoltPhysicsServer3D::_body_add_shape(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
@@ -677,6 +829,8 @@ void JoltPhysicsServer3D::_body_set_shape(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
@@ -691,6 +845,8 @@ void JoltPhysicsServer3D::_body_set_shape_transform(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_shape_transform(p_shape_idx, p_transform);
 }
 
@@ -698,6 +854,8 @@ int32_t JoltPhysicsServer3D::_body_get_shape_count(const RID& p_body) const {
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_shape_count();
 }
 
@@ -705,6 +863,8 @@ RID JoltPhysicsServer3D::_body_get_shape(const RID& p_body, int32_t p_shape_idx)
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	const JoltShapeImpl3D* shape = body->get_shape(p_shape_idx);
 	ERR_FAIL_NULL_D(shape);
 
@@ -716,6 +876,8 @@ Transform3D JoltPhysicsServer3D::_body_get_shape_transform(const RID& p_body, in
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_shape_transform_scaled(p_shape_idx);
 }
 
@@ -723,6 +885,8 @@ void JoltPhysicsServer3D::_body_remove_shape(const RID& p_body, int32_t p_shape_
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->remove_shape(p_shape_idx);
 }
 
@@ -730,6 +894,8 @@ void JoltPhysicsServer3D::_body_clear_shapes(const RID& p_body) {
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->clear_shapes();
 }
 
@@ -741,10 +907,14 @@ void JoltPhysicsServer3D::_body_set_shape_disabled(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_shape_disabled(p_shape_idx, p_disabled);
 }
 
 void JoltPhysicsServer3D::_body_attach_object_instance_id(const RID& p_body, uint64_t p_id) {
+	wait_for_step();
+
 	if (JoltBodyImpl3D* body = body_owner.get_or_null(p_body)) {
 		body->set_instance_id(ObjectID(p_id));
 	} else if (JoltSoftBodyImpl3D* soft_body = soft_body_owner.get_or_null(p_body)) {
@@ -758,6 +928,8 @@ uint64_t JoltPhysicsServer3D::_body_get_object_instance_id(const RID& p_body) co
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_instance_id();
 }
 
@@ -768,6 +940,8 @@ void JoltPhysicsServer3D::_body_set_enable_continuous_collision_detection(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_ccd_enabled(p_enable);
 }
 
@@ -775,6 +949,8 @@ bool JoltPhysicsServer3D::_body_is_continuous_collision_detection_enabled(const
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->is_ccd_enabled();
 }
 
@@ -782,6 +958,8 @@ void JoltPhysicsServer3D::_body_set_collision_layer(const RID& p_body, uint32_t
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_collision_layer(p_layer);
 }
 
@@ -789,6 +967,8 @@ uint32_t JoltPhysicsServer3D::_body_get_collision_layer(const RID& p_body) const
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_collision_layer();
 }
 
@@ -796,6 +976,8 @@ void JoltPhysicsServer3D::_body_set_collision_mask(const RID& p_body, uint32_t p
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_collision_mask(p_mask);
 }
 
@@ -803,6 +985,8 @@ uint32_t JoltPhysicsServer3D::_body_get_collision_mask(const RID& p_body) const
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_collision_mask();
 }
 
@@ -810,6 +994,8 @@ void JoltPhysicsServer3D::_body_set_collision_priority(const RID& p_body, double
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_collision_priority((float)p_priority);
 }
 
@@ -817,6 +1003,8 @@ double JoltPhysicsServer3D::_body_get_collision_priority(const RID& p_body) cons
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return (double)body->get_collision_priority();
 }
 
@@ -824,6 +1012,8 @@ void JoltPhysicsServer3D::_body_set_user_flags(
 	[[maybe_unused]] const RID& p_body,
 	[[maybe_unused]] uint32_t p_flags
 ) {
+	wait_for_step();
+
 	WARN_PRINT(
 		"Body user flags are not supported by Godot Jolt. "
 		"Any such value will be ignored."
@@ -831,6 +1021,8 @@ void JoltPhysicsServer3D::_body_set_user_flags(
 }
 
 uint32_t JoltPhysicsServer3D::_body_get_user_flags([[maybe_unused]] const RID& p_body) const {
+	wait_for_step();
+
 	return 0;
 }
 
@@ -842,6 +1034,8 @@ void JoltPhysicsServer3D::_body_set_param(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_param(p_param, p_value);
 }
 
@@ -849,6 +1043,8 @@ Variant JoltPhysicsServer3D::_body_get_param(const RID& p_body, BodyParameter p_
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_param(p_param);
 }
 
@@ -856,6 +1052,8 @@ void JoltPhysicsServer3D::_body_reset_mass_properties(const RID& p_body) {
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->reset_mass_properties();
 }
 
@@ -867,6 +1065,8 @@ void JoltPhysicsServer3D::_body_set_state(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_state(p_state, p_value);
 }
 
@@ -874,6 +1074,8 @@ Variant JoltPhysicsServer3D::_body_get_state(const RID& p_body, BodyState p_stat
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_state(p_state);
 }
 
@@ -881,6 +1083,8 @@ void JoltPhysicsServer3D::_body_apply_central_impulse(const RID& p_body, const V
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->apply_central_impulse(p_impulse);
 }
 
@@ -892,6 +1096,8 @@ void JoltPhysicsServer3D::_body_apply_impulse(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->apply_impulse(p_impulse, p_position);
 }
 
@@ -899,6 +1105,8 @@ void JoltPhysicsServer3D::_body_apply_torque_impulse(const RID& p_body, const Ve
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->apply_torque_impulse(p_impulse);
 }
 
@@ -906,6 +1114,8 @@ void JoltPhysicsServer3D::_body_apply_central_force(const RID& p_body, const Vec
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->apply_central_force(p_force);
 }
 
@@ -917,6 +1127,8 @@ void JoltPhysicsServer3D::_body_apply_force(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->apply_force(p_force, p_position);
 }
 
@@ -924,6 +1136,8 @@ void JoltPhysicsServer3D::_body_apply_torque(const RID& p_body, const Vector3& p
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->apply_torque(p_torque);
 }
 
@@ -934,6 +1148,8 @@ void JoltPhysicsServer3D::_body_add_constant_central_force(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->add_constant_central_force(p_force);
 }
 
@@ -945,6 +1161,8 @@ void JoltPhysicsServer3D::_body_add_constant_force(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->add_constant_force(p_force, p_position);
 }
 
@@ -952,6 +1170,8 @@ void JoltPhysicsServer3D::_body_add_constant_torque(const RID& p_body, const Vec
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->add_constant_torque(p_torque);
 }
 
@@ -959,6 +1179,8 @@ void JoltPhysicsServer3D::_body_set_constant_force(const RID& p_body, const Vect
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_constant_force(p_force);
 }
 
@@ -966,6 +1188,8 @@ Vector3 JoltPhysicsServer3D::_body_get_constant_force(const RID& p_body) const {
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_constant_force();
 }
 
@@ -973,6 +1197,8 @@ void JoltPhysicsServer3D::_body_set_constant_torque(const RID& p_body, const Vec
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_constant_torque(p_torque);
 }
 
@@ -980,6 +1206,8 @@ Vector3 JoltPhysicsServer3D::_body_get_constant_torque(const RID& p_body) const
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_constant_torque();
 }
 
@@ -990,6 +1218,8 @@ void JoltPhysicsServer3D::_body_set_axis_velocity(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_axis_velocity(p_axis_velocity);
 }
 
@@ -997,6 +1227,8 @@ void JoltPhysicsServer3D::_body_set_axis_lock(const RID& p_body, BodyAxis p_axis
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_axis_lock(p_axis, p_lock);
 }
 
@@ -1004,6 +1236,8 @@ bool JoltPhysicsServer3D::_body_is_axis_locked(const RID& p_body, BodyAxis p_axi
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->is_axis_locked(p_axis);
 }
 
@@ -1014,6 +1248,8 @@ void JoltPhysicsServer3D::_body_add_collision_exception(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->add_collision_exception(p_excepted_body);
 }
 
@@ -1024,6 +1260,8 @@ void JoltPhysicsServer3D::_body_remove_collision_exception(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->remove_collision_exception(p_excepted_body);
 }
 
@@ -1031,6 +1269,8 @@ TypedArray<RID> JoltPhysicsServer3D::_body_get_collision_exceptions(const RID& p
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_collision_exceptions();
 }
 
@@ -1038,6 +1278,8 @@ void JoltPhysicsServer3D::_body_set_max_contacts_reported(const RID& p_body, int
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->set_max_contacts_reported(p_amount);
 }
 
@@ -1045,6 +1287,8 @@ int32_t JoltPhysicsServer3D::_body_get_max_contacts_reported(const RID& p_body)
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_max_contacts_reported();
 }
 
@@ -1052,6 +1296,8 @@ void JoltPhysicsServer3D::_body_set_contacts_reported_depth_threshold(
 	[[maybe_unused]] const RID& p_body,
 	[[maybe_unused]] double p_threshold
 ) {
+	wait_for_step();
+
 	WARN_PRINT(
 		"Per-body contact depth threshold is not supported by Godot Jolt. "
 		"Any such value will be ignored."
@@ -1061,6 +1307,8 @@ void JoltPhysicsServer3D::_body_set_contacts_reported_depth_threshold(
 double JoltPhysicsServer3D::_body_get_contacts_reported_depth_threshold(
 	[[maybe_unused]] const RID& p_body
 ) const {
+	wait_for_step();
+
 	return 0.0;
 }
 
@@ -1068,6 +1316,8 @@ void JoltPhysicsServer3D::_body_set_omit_force_integration(const RID& p_body, bo
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_custom_integrator(p_enable);
 }
 
@@ -1075,6 +1325,8 @@ bool JoltPhysicsServer3D::_body_is_omitting_force_integration(const RID& p_body)
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->has_custom_integrator();
 }
 
@@ -1085,6 +1337,8 @@ void JoltPhysicsServer3D::_body_set_state_sync_callback(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_state_sync_callback(p_callable);
 }
 
@@ -1096,6 +1350,8 @@ void JoltPhysicsServer3D::_body_set_force_integration_callback(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_custom_integration_callback(p_callable, p_userdata);
 }
 
@@ -1103,6 +1359,8 @@ void JoltPhysicsServer3D::_body_set_ray_pickable(const RID& p_body, bool p_enabl
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_pickable(p_enable);
 }
 
@@ -1119,6 +1377,8 @@ bool JoltPhysicsServer3D::_body_test_motion(
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	JoltSpace3D* space = body->get_space();
 	ERR_FAIL_NULL_D(space);
 
@@ -1137,6 +1397,8 @@ bool JoltPhysicsServer3D::_body_test_motion(
 PhysicsDirectBodyState3D* JoltPhysicsServer3D::_body_get_direct_state(const RID& p_body) {
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 
+	wait_for_step();
+
 	// Unlike most other server methods this one is meant to quietly return null if the body has
 	// since been freed, which is used in places like `move_and_slide` to determine whether a
 	// previously used platform has been freed or not.
@@ -1159,6 +1421,8 @@ void JoltPhysicsServer3D::_soft_body_update_rendering_server(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->update_rendering_server(p_rendering_server_handler);
 }
 
@@ -1166,6 +1430,8 @@ void JoltPhysicsServer3D::_soft_body_set_space(const RID& p_body, const RID& p_s
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	JoltSpace3D* space = nullptr;
 
 	if (p_space.is_valid()) {
@@ -1180,6 +1446,8 @@ RID JoltPhysicsServer3D::_soft_body_get_space(const RID& p_body) const {
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	const JoltSpace3D* space = body->get_space();
 
 	if (space == nullptr) {
@@ -1193,6 +1461,8 @@ void JoltPhysicsServer3D::_soft_body_set_mesh(const RID& p_body, const RID& p_me
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_mesh(p_mesh);
 }
 
@@ -1200,6 +1470,8 @@ AABB JoltPhysicsServer3D::_soft_body_get_bounds(const RID& p_body) const {
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_bounds();
 }
 
@@ -1207,6 +1479,8 @@ void JoltPhysicsServer3D::_soft_body_set_collision_layer(const RID& p_body, uint
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_collision_layer(p_layer);
 }
 
@@ -1214,6 +1488,8 @@ uint32_t JoltPhysicsServer3D::_soft_body_get_collision_layer(const RID& p_body)
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_collision_layer();
 }
 
@@ -1221,6 +1497,8 @@ void JoltPhysicsServer3D::_soft_body_set_collision_mask(const RID& p_body, uint3
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_collision_mask(p_mask);
 }
 
@@ -1228,6 +1506,8 @@ uint32_t JoltPhysicsServer3D::_soft_body_get_collision_mask(const RID& p_body) c
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_collision_mask();
 }
 
@@ -1238,6 +1518,8 @@ void JoltPhysicsServer3D::_soft_body_add_collision_exception(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->add_collision_exception(p_excepted_body);
 }
 
@@ -1248,6 +1530,8 @@ void JoltPhysicsServer3D::_soft_body_remove_collision_exception(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->remove_collision_exception(p_excepted_body);
 }
 
@@ -1255,6 +1539,8 @@ TypedArray<RID> JoltPhysicsServer3D::_soft_body_get_collision_exceptions(const R
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_collision_exceptions();
 }
 
@@ -1266,6 +1552,8 @@ void JoltPhysicsServer3D::_soft_body_set_state(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_state(p_state, p_value);
 }
 
@@ -1273,6 +1561,8 @@ Variant JoltPhysicsServer3D::_soft_body_get_state(const RID& p_body, BodyState p
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_state(p_state);
 }
 
@@ -1283,6 +1573,8 @@ void JoltPhysicsServer3D::_soft_body_set_transform(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->set_transform(p_transform);
 }
 
@@ -1290,6 +1582,8 @@ void JoltPhysicsServer3D::_soft_body_set_ray_pickable(const RID& p_body, bool p_
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->set_pickable(p_enable);
 }
 
@@ -1300,6 +1594,8 @@ void JoltPhysicsServer3D::_soft_body_set_simulation_precision(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->set_simulation_precision(p_precision);
 }
 
@@ -1307,6 +1603,8 @@ int32_t JoltPhysicsServer3D::_soft_body_get_simulation_precision(const RID& p_bo
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_simulation_precision();
 }
 
@@ -1314,6 +1612,8 @@ void JoltPhysicsServer3D::_soft_body_set_total_mass(const RID& p_body, double p_
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->set_mass((float)p_total_mass);
 }
 
@@ -1321,6 +1621,8 @@ double JoltPhysicsServer3D::_soft_body_get_total_mass(const RID& p_body) const {
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return (double)body->get_mass();
 }
 
@@ -1328,6 +1630,8 @@ void JoltPhysicsServer3D::_soft_body_set_linear_stiffness(const RID& p_body, dou
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->set_stiffness_coefficient((float)p_coefficient);
 }
 
@@ -1335,6 +1639,8 @@ double JoltPhysicsServer3D::_soft_body_get_linear_stiffness(const RID& p_body) c
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return (double)body->get_stiffness_coefficient();
 }
 
@@ -1345,6 +1651,8 @@ void JoltPhysicsServer3D::_soft_body_set_pressure_coefficient(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->set_pressure((float)p_coefficient);
 }
 
@@ -1352,6 +1660,8 @@ double JoltPhysicsServer3D::_soft_body_get_pressure_coefficient(const RID& p_bod
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return (double)body->get_pressure();
 }
 
@@ -1362,6 +1672,8 @@ void JoltPhysicsServer3D::_soft_body_set_damping_coefficient(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->set_linear_damping((float)p_coefficient);
 }
 
@@ -1369,6 +1681,8 @@ double JoltPhysicsServer3D::_soft_body_get_damping_coefficient(const RID& p_body
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return (double)body->get_linear_damping();
 }
 
@@ -1376,6 +1690,8 @@ void JoltPhysicsServer3D::_soft_body_set_drag_coefficient(const RID& p_body, dou
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	return body->set_drag((float)p_coefficient);
 }
 
@@ -1383,6 +1699,8 @@ double JoltPhysicsServer3D::_soft_body_get_drag_coefficient(const RID& p_body) c
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return (double)body->get_drag();
 }
 
@@ -1394,6 +1712,8 @@ void JoltPhysicsServer3D::_soft_body_move_point(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->set_vertex_position(p_point_index, p_global_position);
 }
 
@@ -1404,6 +1724,8 @@ Vector3 JoltPhysicsServer3D::_soft_body_get_point_global_position(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->get_vertex_position(p_point_index);
 }
 
@@ -1411,6 +1733,8 @@ void JoltPhysicsServer3D::_soft_body_remove_all_pinned_points(const RID& p_body)
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	body->unpin_all_vertices();
 }
 
@@ -1422,6 +1746,8 @@ void JoltPhysicsServer3D::_soft_body_pin_point(
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
+	wait_for_step();
+
 	if (p_pin) {
 		body->pin_vertex(p_point_index);
 	} else {
@@ -1434,6 +1760,8 @@ bool JoltPhysicsServer3D::_soft_body_is_point_pinned(const RID& p_body, int32_t
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
+	wait_for_step();
+
 	return body->is_vertex_pinned(p_point_index);
 }
 
@@ -1448,6 +1776,8 @@ void JoltPhysicsServer3D::_joint_clear(const RID& p_joint) {
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	if (joint->get_type() != JOINT_TYPE_MAX) {
 		JoltJointImpl3D* empty_joint = memnew(JoltJointImpl3D);
 		empty_joint->set_rid(joint->get_rid());
@@ -1467,6 +1797,8 @@ void JoltPhysicsServer3D::_joint_make_pin(
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
+	wait_for_step();
+
 	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
@@ -1489,6 +1821,8 @@ void JoltPhysicsServer3D::_pin_joint_set_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_PIN);
 	auto* pin_joint = static_cast<JoltPinJointImpl3D*>(joint);
 
@@ -1499,6 +1833,8 @@ double JoltPhysicsServer3D::_pin_joint_get_param(const RID& p_joint, PinJointPar
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_PIN);
 	const auto* pin_joint = static_cast<const JoltPinJointImpl3D*>(joint);
 
@@ -1509,6 +1845,8 @@ void JoltPhysicsServer3D::_pin_joint_set_local_a(const RID& p_joint, const Vecto
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_PIN);
 	auto* pin_joint = static_cast<JoltPinJointImpl3D*>(joint);
 
@@ -1519,6 +1857,8 @@ Vector3 JoltPhysicsServer3D::_pin_joint_get_local_a(const RID& p_joint) const {
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_PIN);
 	const auto* pin_joint = static_cast<const JoltPinJointImpl3D*>(joint);
 
@@ -1529,6 +1869,8 @@ void JoltPhysicsServer3D::_pin_joint_set_local_b(const RID& p_joint, const Vecto
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_PIN);
 	auto* pin_joint = static_cast<JoltPinJointImpl3D*>(joint);
 
@@ -1539,6 +1881,8 @@ Vector3 JoltPhysicsServer3D::_pin_joint_get_local_b(const RID& p_joint) const {
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_PIN);
 	const auto* pin_joint = static_cast<const JoltPinJointImpl3D*>(joint);
 
@@ -1555,6 +1899,8 @@ void JoltPhysicsServer3D::_joint_make_hinge(
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
+	wait_for_step();
+
 	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
@@ -1578,6 +1924,8 @@ void JoltPhysicsServer3D::_joint_make_hinge_simple(
 	[[maybe_unused]] const Vector3& p_pivot_b,
 	[[maybe_unused]] const Vector3& p_axis_b
 ) {
+	wait_for_step();
+
 	// HACK(mihe): This method doesn't seem to be used anywhere within Godot, and isn't exposed in
 	// the bindings, so this will be unsupported until anyone actually needs it.
 	ERR_FAIL_MSG("Simple hinge joints are not supported by Godot Jolt.");
@@ -1591,6 +1939,8 @@ void JoltPhysicsServer3D::_hinge_joint_set_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_HINGE);
 	auto* hinge_joint = static_cast<JoltHingeJointImpl3D*>(joint);
 
@@ -1602,6 +1952,8 @@ double JoltPhysicsServer3D::_hinge_joint_get_param(const RID& p_joint, HingeJoin
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
 	const auto* hinge_joint = static_cast<const JoltHingeJointImpl3D*>(joint);
 
@@ -1616,6 +1968,8 @@ void JoltPhysicsServer3D::_hinge_joint_set_flag(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_HINGE);
 	auto* hinge_joint = static_cast<JoltHingeJointImpl3D*>(joint);
 
@@ -1626,6 +1980,8 @@ bool JoltPhysicsServer3D::_hinge_joint_get_flag(const RID& p_joint, HingeJointFl
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
 	const auto* hinge_joint = static_cast<const JoltHingeJointImpl3D*>(joint);
 
@@ -1642,6 +1998,8 @@ void JoltPhysicsServer3D::_joint_make_slider(
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
+	wait_for_step();
+
 	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
@@ -1664,6 +2022,8 @@ void JoltPhysicsServer3D::_slider_joint_set_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_SLIDER);
 	auto* slider_joint = static_cast<JoltSliderJointImpl3D*>(joint);
 
@@ -1675,6 +2035,8 @@ double JoltPhysicsServer3D::_slider_joint_get_param(const RID& p_joint, SliderJo
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
 	const auto* slider_joint = static_cast<const JoltSliderJointImpl3D*>(joint);
 
@@ -1691,6 +2053,8 @@ void JoltPhysicsServer3D::_joint_make_cone_twist(
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
+	wait_for_step();
+
 	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
@@ -1713,6 +2077,8 @@ void JoltPhysicsServer3D::_cone_twist_joint_set_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_CONE_TWIST);
 	auto* cone_twist_joint = static_cast<JoltConeTwistJointImpl3D*>(joint);
 
@@ -1726,6 +2092,8 @@ double JoltPhysicsServer3D::_cone_twist_joint_get_param(
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
 	const auto* cone_twist_joint = static_cast<const JoltConeTwistJointImpl3D*>(joint);
 
@@ -1742,6 +2110,8 @@ void JoltPhysicsServer3D::_joint_make_generic_6dof(
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
+	wait_for_step();
+
 	JoltBodyImpl3D* body_a = body_owner.get_or_null(p_body_a);
 	ERR_FAIL_NULL(body_a);
 
@@ -1765,6 +2135,8 @@ void JoltPhysicsServer3D::_generic_6dof_joint_set_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_6DOF);
 	auto* g6dof_joint = static_cast<JoltGeneric6DOFJointImpl3D*>(joint);
 
@@ -1779,6 +2151,8 @@ double JoltPhysicsServer3D::_generic_6dof_joint_get_param(
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
 	const auto* g6dof_joint = static_cast<const JoltGeneric6DOFJointImpl3D*>(joint);
 
@@ -1794,6 +2168,8 @@ void JoltPhysicsServer3D::_generic_6dof_joint_set_flag(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_6DOF);
 	auto* g6dof_joint = static_cast<JoltGeneric6DOFJointImpl3D*>(joint);
 
@@ -1808,6 +2184,8 @@ bool JoltPhysicsServer3D::_generic_6dof_joint_get_flag(
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
 	const auto* g6dof_joint = static_cast<const JoltGeneric6DOFJointImpl3D*>(joint);
 
@@ -1818,6 +2196,8 @@ PhysicsServer3D::JointType JoltPhysicsServer3D::_joint_get_type(const RID& p_joi
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	return joint->get_type();
 }
 
@@ -1825,6 +2205,8 @@ void JoltPhysicsServer3D::_joint_set_solver_priority(const RID& p_joint, int32_t
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	joint->set_solver_priority(p_priority);
 }
 
@@ -1832,6 +2214,8 @@ int32_t JoltPhysicsServer3D::_joint_get_solver_priority(const RID& p_joint) cons
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	return joint->get_solver_priority();
 }
 
@@ -1842,6 +2226,8 @@ void JoltPhysicsServer3D::_joint_disable_collisions_between_bodies(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	joint->set_collision_disabled(p_disable);
 }
 
@@ -1849,10 +2235,14 @@ bool JoltPhysicsServer3D::_joint_is_disabled_collisions_between_bodies(const RID
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	return joint->is_collision_disabled();
 }
 
 void JoltPhysicsServer3D::_free_rid(const RID& p_rid) {
+	wait_for_step();
+
 	if (JoltShapeImpl3D* shape = shape_owner.get_or_null(p_rid)) {
 		free_shape(shape);
 	} else if (JoltBodyImpl3D* body = body_owner.get_or_null(p_rid)) {
@@ -1871,11 +2261,18 @@ void JoltPhysicsServer3D::_free_rid(const RID& p_rid) {
 }
 
 void JoltPhysicsServer3D::_set_active(bool p_active) {
+	wait_for_step();
+
 	active = p_active;
 }
 
 void JoltPhysicsServer3D::_init() {
 	job_system = new JoltJobSystem();
+	temp_allocator_pool = new JoltTempAllocatorPool();
+
+	JoltProfiler::set_enabled(JoltProjectSettings::is_profiler_enabled());
+
+	jolt_set_huge_pages_enabled(JoltProjectSettings::use_huge_pages());
 }
 
 void JoltPhysicsServer3D::_step(double p_step) {
@@ -1883,13 +2280,31 @@ void JoltPhysicsServer3D::_step(double p_step) {
 		return;
 	}
 
-	for (JoltSpace3D* active_space : active_spaces) {
-		job_system->pre_step();
+	wait_for_step();
 
-		active_space->step((float)p_step);
+	if (!JoltProjectSettings::should_run_on_separate_thread()) {
+		_step_spaces((float)p_step);
+		return;
+	}
 
-		job_system->post_step();
+	for (JoltSpace3D* active_space : active_spaces) {
+		active_space->set_stepping(true);
 	}
+
+	pending_step = (float)p_step;
+
+	static const String task_name("JoltPhysicsStep");
+
+	step_task_id = WorkerThreadPool::get_singleton()->add_native_task(
+		&_step_task,
+		this,
+		true,
+		task_name
+	);
+}
+
+void JoltPhysicsServer3D::_sync() {
+	wait_for_step();
 }
 
 void JoltPhysicsServer3D::_flush_queries() {
@@ -1897,6 +2312,8 @@ void JoltPhysicsServer3D::_flush_queries() {
 		return;
 	}
 
+	wait_for_step();
+
 	flushing_queries = true;
 
 	for (JoltSpace3D* space : active_spaces) {
@@ -1915,15 +2332,26 @@ void JoltPhysicsServer3D::_space_step(const RID &space, double delta) {
 	// fail if space is null
 	ERR_FAIL_NULL(_space);
 
+	wait_for_step();
+
+	JoltProfiler::begin_frame();
+
 	// we want to step only the selected space;
 	job_system->pre_step(); 
 
 	_space->step((float)delta);
 
 	job_system->post_step();
+
+	temp_allocator_pool->post_step();
+
+	_schedule_broad_phase_optimization(_space);
+	_start_broad_phase_optimizations();
 }
 
 void JoltPhysicsServer3D::_space_flush_queries(const RID &space) {
+	wait_for_step();
+
 	flushing_queries = true;
 
 	JoltSpace3D *_space = space_owner.get_or_null(space);
@@ -1935,6 +2363,9 @@ void JoltPhysicsServer3D::_space_flush_queries(const RID &space) {
 }
 
 void JoltPhysicsServer3D::_finish() {
+	wait_for_step();
+
+	delete_safely(temp_allocator_pool);
 	delete_safely(job_system);
 }
 
@@ -1942,8 +2373,143 @@ bool JoltPhysicsServer3D::_is_flushing_queries() const {
 	return flushing_queries;
 }
 
-int32_t JoltPhysicsServer3D::_get_process_info([[maybe_unused]] ProcessInfo p_process_info) {
-	return 0;
+int32_t JoltPhysicsServer3D::_get_process_info(ProcessInfo p_process_info) {
+	// These are all based on atomic snapshots taken at the end of each step, so we don't need to
+	// wait for any step that might be running on a separate thread.
+
+	int32_t total = 0;
+
+	switch (p_process_info) {
+		case INFO_ACTIVE_OBJECTS: {
+			for (const JoltSpace3D* space : active_spaces) {
+				total += space->get_active_body_count();
+			}
+		} break;
+		case INFO_COLLISION_PAIRS: {
+			for (const JoltSpace3D* space : active_spaces) {
+				total += space->get_contact_manifold_count();
+			}
+		} break;
+		case INFO_ISLAND_COUNT: {
+			// Jolt doesn't expose its simulation islands, so there's nothing we can report here
+		} break;
+		default: {
+			ERR_FAIL_D_MSG(vformat("Unhandled process info: '%d'", p_process_info));
+		} break;
+	}
+
+	return total;
+}
+
+void JoltPhysicsServer3D::wait_for_step() const {
+	if (step_task_id != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(step_task_id);
+
+		step_task_id = -1;
+
+		for (JoltSpace3D* active_space : active_spaces) {
+			active_space->set_stepping(false);
+		}
+	}
+
+	// The broadphase optimizations are started by the step itself, so we can only know about them
+	// once we've waited for the step.
+	if (optimization_task_id != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(optimization_task_id);
+
+		optimization_task_id = -1;
+
+		optimizing_spaces.clear();
+	}
+}
+
+void JoltPhysicsServer3D::_step_task(void* p_user_data) {
+	auto* physics_server = static_cast<JoltPhysicsServer3D*>(p_user_data);
+	physics_server->_step_spaces(physics_server->pending_step);
+}
+
+void JoltPhysicsServer3D::_optimize_broad_phase_task(void* p_user_data, uint32_t p_index) {
+	auto* physics_server = static_cast<JoltPhysicsServer3D*>(p_user_data);
+	physics_server->optimizing_spaces[p_index]->optimize_broad_phase();
+}
+
+void JoltPhysicsServer3D::_step_spaces(float p_step) {
+	JoltProfiler::begin_frame();
+
+	JOLT_PROFILE_SCOPE("JoltPhysicsServer3D::_step_spaces");
+
+	if (JoltProjectSettings::should_step_spaces_in_parallel() && active_spaces.size() > 1) {
+		_step_spaces_in_parallel(p_step);
+	} else {
+		for (JoltSpace3D* active_space : active_spaces) {
+			job_system->pre_step();
+
+			active_space->step(p_step);
+
+			job_system->post_step();
+		}
+
+		temp_allocator_pool->post_step();
+	}
+
+	for (JoltSpace3D* active_space : active_spaces) {
+		_schedule_broad_phase_optimization(active_space);
+	}
+
+	_start_broad_phase_optimizations();
+}
+
+void JoltPhysicsServer3D::_step_spaces_in_parallel(float p_step) {
+	stepping_spaces.clear();
+
+	for (JoltSpace3D* active_space : active_spaces) {
+		stepping_spaces.push_back(active_space);
+	}
+
+	// Every space owns its own `PhysicsSystem` and borrows a temporary allocator from the pool for
+	// the duration of its step, so the only other thing they share is the job system. We limit the
+	// number of spaces that can be stepped concurrently, to avoid running out of barriers, by
+	// having each job step a strided subset of the spaces, which also bounds the size of the pool.
+	const auto space_count = (int32_t)stepping_spaces.size();
+	const int32_t job_count = MIN(space_count, job_system->get_max_concurrent_steps());
+
+	job_system->pre_step();
+
+	job_system->run_parallel("StepSpaces", job_count, [&](int32_t p_job_index) {
+		for (int32_t i = p_job_index; i < space_count; i += job_count) {
+			stepping_spaces[i]->step(p_step);
+		}
+	});
+
+	job_system->post_step();
+
+	temp_allocator_pool->post_step();
+}
+
+void JoltPhysicsServer3D::_schedule_broad_phase_optimization(JoltSpace3D* p_space) {
+	if (p_space->needs_broad_phase_optimization()) {
+		optimizing_spaces.push_back(p_space);
+	}
+}
+
+void JoltPhysicsServer3D::_start_broad_phase_optimizations() {
+	if (optimizing_spaces.is_empty()) {
+		return;
+	}
+
+	static const String task_name("JoltPhysicsOptimizeBroadPhase");
+
+	// Optimizing the broadphase is too slow to do as part of the step, and isn't safe to do while
+	// the space is being modified or queried, so we do it in the background instead, and have it be
+	// waited on along with the step, which means it overlaps with the rest of the frame.
+	optimization_task_id = WorkerThreadPool::get_singleton()->add_native_group_task(
+		&_optimize_broad_phase_task,
+		this,
+		(int32_t)optimizing_spaces.size(),
+		-1,
+		false,
+		task_name
+	);
 }
 
 void JoltPhysicsServer3D::free_space(JoltSpace3D* p_space) {
@@ -1997,6 +2563,8 @@ void JoltPhysicsServer3D::free_joint(JoltJointImpl3D* p_joint) {
 #ifdef GDJ_CONFIG_EDITOR
 
 void JoltPhysicsServer3D::dump_debug_snapshots(const String& p_dir) {
+	wait_for_step();
+
 	for (JoltSpace3D* space : active_spaces) {
 		space->dump_debug_snapshot(p_dir);
 	}
@@ -2006,15 +2574,247 @@ void JoltPhysicsServer3D::space_dump_debug_snapshot(const RID& p_space, const St
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
 
+	wait_for_step();
+
 	space->dump_debug_snapshot(p_dir);
 }
 
 #endif // GDJ_CONFIG_EDITOR
 
+double JoltPhysicsServer3D::space_get_jolt_param(const RID& p_space, SpaceParamJolt p_param)
+	const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	wait_for_step();
+
+	return space->get_jolt_param(p_param);
+}
+
+void JoltPhysicsServer3D::space_set_jolt_param(
+	const RID& p_space,
+	SpaceParamJolt p_param,
+	double p_value
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	wait_for_step();
+
+	space->set_jolt_param(p_param, p_value);
+}
+
+bool JoltPhysicsServer3D::space_get_jolt_flag(const RID& p_space, SpaceFlagJolt p_flag) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	wait_for_step();
+
+	return space->get_jolt_flag(p_flag);
+}
+
+void JoltPhysicsServer3D::space_set_jolt_flag(
+	const RID& p_space,
+	SpaceFlagJolt p_flag,
+	bool p_enabled
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	wait_for_step();
+
+	space->set_jolt_flag(p_flag, p_enabled);
+}
+
+void JoltPhysicsServer3D::space_apply_jolt_quality_preset(
+	const RID& p_space,
+	SpaceQualityPresetJolt p_preset
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	wait_for_step();
+
+	space->apply_quality_preset(p_preset);
+}
+
+void JoltPhysicsServer3D::space_begin_bulk_add(const RID& p_space) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	wait_for_step();
+
+	space->begin_bulk_add();
+}
+
+void JoltPhysicsServer3D::space_end_bulk_add(const RID& p_space) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	wait_for_step();
+
+	space->end_bulk_add();
+}
+
+Dictionary JoltPhysicsServer3D::space_get_broad_phase_stats(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	wait_for_step();
+
+	return space->get_broad_phase_stats();
+}
+
+Dictionary JoltPhysicsServer3D::space_get_stats(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	wait_for_step();
+
+	return space->get_stats();
+}
+
+double JoltPhysicsServer3D::body_get_jolt_param(const RID& p_body, BodyParamJolt p_param) const {
+	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	wait_for_step();
+
+	return body->get_jolt_param(p_param);
+}
+
+void JoltPhysicsServer3D::body_set_jolt_param(
+	const RID& p_body,
+	BodyParamJolt p_param,
+	double p_value
+) {
+	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+
+	wait_for_step();
+
+	body->set_jolt_param(p_param, p_value);
+}
+
+bool JoltPhysicsServer3D::body_get_jolt_flag(const RID& p_body, BodyFlagJolt p_flag) const {
+	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	wait_for_step();
+
+	return body->get_jolt_flag(p_flag);
+}
+
+void JoltPhysicsServer3D::body_set_jolt_flag(
+	const RID& p_body,
+	BodyFlagJolt p_flag,
+	bool p_enabled
+) {
+	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+
+	wait_for_step();
+
+	body->set_jolt_flag(p_flag, p_enabled);
+}
+
+void JoltPhysicsServer3D::area_set_batched_monitor_callback(
+	const RID& p_area,
+	const Callable& p_callback
+) {
+	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL(area);
+
+	wait_for_step();
+
+	area->set_batched_monitor_callback(p_callback);
+}
+
+JoltPhysicsServer3D::AreaMonitorModeJolt JoltPhysicsServer3D::area_get_jolt_monitor_mode(
+	const RID& p_area
+) const {
+	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL_D(area);
+
+	wait_for_step();
+
+	return area->get_monitor_mode();
+}
+
+void JoltPhysicsServer3D::area_set_jolt_monitor_mode(
+	const RID& p_area,
+	AreaMonitorModeJolt p_mode
+) {
+	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL(area);
+
+	wait_for_step();
+
+	area->set_monitor_mode(p_mode);
+}
+
+int32_t JoltPhysicsServer3D::area_get_jolt_overlap_count(const RID& p_area) const {
+	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL_D(area);
+
+	wait_for_step();
+
+	return area->get_overlap_count();
+}
+
+Dictionary JoltPhysicsServer3D::get_job_system_stats() const {
+	ERR_FAIL_NULL_D(job_system);
+
+	wait_for_step();
+
+	Dictionary stats;
+	stats["dedicated_threads"] = job_system->uses_dedicated_threads();
+	stats["thread_count"] = job_system->get_thread_count();
+	stats["queued_jobs"] = job_system->get_queued_job_count();
+	stats["queue_time_usec"] = (double)job_system->get_queue_time_nsec() / 1000.0;
+	stats["wait_idle_usec"] = (double)job_system->get_wait_idle_nsec() / 1000.0;
+	stats["wait_helping_usec"] = (double)job_system->get_wait_helping_nsec() / 1000.0;
+	stats["jobs_last_step"] = job_system->get_last_step_job_count();
+	stats["jobs_peak_step"] = job_system->get_peak_step_job_count();
+	stats["job_capacity"] = job_system->get_job_capacity();
+
+	return stats;
+}
+
+Dictionary JoltPhysicsServer3D::get_temp_memory_stats() {
+	ERR_FAIL_NULL_D(temp_allocator_pool);
+
+	wait_for_step();
+
+	return temp_allocator_pool->get_stats();
+}
+
+bool JoltPhysicsServer3D::is_profiler_enabled() const {
+	return JoltProfiler::is_enabled();
+}
+
+void JoltPhysicsServer3D::set_profiler_enabled(bool p_enabled) {
+	JoltProfiler::set_enabled(p_enabled);
+}
+
+String JoltPhysicsServer3D::dump_profiler_trace(int32_t p_frame_count) {
+	wait_for_step();
+
+	return JoltProfiler::dump_chrome_trace(p_frame_count);
+}
+
+Error JoltPhysicsServer3D::write_profiler_trace(const String& p_path, int32_t p_frame_count) {
+	wait_for_step();
+
+	return JoltProfiler::write_chrome_trace(p_path, p_frame_count);
+}
+
 bool JoltPhysicsServer3D::joint_get_enabled(const RID& p_joint) const {
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	return joint->is_enabled();
 }
 
@@ -2022,6 +2822,8 @@ void JoltPhysicsServer3D::joint_set_enabled(const RID& p_joint, bool p_enabled)
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	joint->set_enabled(p_enabled);
 }
 
@@ -2029,6 +2831,8 @@ int32_t JoltPhysicsServer3D::joint_get_solver_velocity_iterations(const RID& p_j
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	return joint->get_solver_velocity_iterations();
 }
 
@@ -2039,6 +2843,8 @@ void JoltPhysicsServer3D::joint_set_solver_velocity_iterations(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	return joint->set_solver_velocity_iterations(p_value);
 }
 
@@ -2046,6 +2852,8 @@ int32_t JoltPhysicsServer3D::joint_get_solver_position_iterations(const RID& p_j
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	return joint->get_solver_position_iterations();
 }
 
@@ -2056,6 +2864,8 @@ void JoltPhysicsServer3D::joint_set_solver_position_iterations(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	return joint->set_solver_position_iterations(p_value);
 }
 
@@ -2063,6 +2873,8 @@ float JoltPhysicsServer3D::pin_joint_get_applied_force(const RID& p_joint) {
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_PIN);
 	auto* pin_joint = static_cast<JoltPinJointImpl3D*>(joint);
 
@@ -2076,6 +2888,8 @@ double JoltPhysicsServer3D::hinge_joint_get_jolt_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
 	auto* hinge_joint = static_cast<JoltHingeJointImpl3D*>(joint);
 
@@ -2090,6 +2904,8 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_HINGE);
 	auto* hinge_joint = static_cast<JoltHingeJointImpl3D*>(joint);
 
@@ -2101,6 +2917,8 @@ bool JoltPhysicsServer3D::hinge_joint_get_jolt_flag(const RID& p_joint, HingeJoi
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
 	const auto* hinge_joint = static_cast<const JoltHingeJointImpl3D*>(joint);
 
@@ -2115,6 +2933,8 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_flag(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_HINGE);
 	auto* hinge_joint = static_cast<JoltHingeJointImpl3D*>(joint);
 
@@ -2125,6 +2945,8 @@ float JoltPhysicsServer3D::hinge_joint_get_applied_force(const RID& p_joint) {
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
 	auto* hinge_joint = static_cast<JoltHingeJointImpl3D*>(joint);
 
@@ -2135,6 +2957,8 @@ float JoltPhysicsServer3D::hinge_joint_get_applied_torque(const RID& p_joint) {
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_HINGE);
 	auto* hinge_joint = static_cast<JoltHingeJointImpl3D*>(joint);
 
@@ -2148,6 +2972,8 @@ double JoltPhysicsServer3D::slider_joint_get_jolt_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
 	auto* slider_joint = static_cast<JoltSliderJointImpl3D*>(joint);
 
@@ -2162,6 +2988,8 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_SLIDER);
 	auto* slider_joint = static_cast<JoltSliderJointImpl3D*>(joint);
 
@@ -2173,6 +3001,8 @@ bool JoltPhysicsServer3D::slider_joint_get_jolt_flag(const RID& p_joint, SliderJ
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
 	const auto* slider_joint = static_cast<const JoltSliderJointImpl3D*>(joint);
 
@@ -2187,6 +3017,8 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_flag(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_SLIDER);
 	auto* slider_joint = static_cast<JoltSliderJointImpl3D*>(joint);
 
@@ -2197,6 +3029,8 @@ float JoltPhysicsServer3D::slider_joint_get_applied_force(const RID& p_joint) {
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
 	auto* slider_joint = static_cast<JoltSliderJointImpl3D*>(joint);
 
@@ -2207,6 +3041,8 @@ float JoltPhysicsServer3D::slider_joint_get_applied_torque(const RID& p_joint) {
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_SLIDER);
 	auto* slider_joint = static_cast<JoltSliderJointImpl3D*>(joint);
 
@@ -2220,6 +3056,8 @@ double JoltPhysicsServer3D::cone_twist_joint_get_jolt_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
 	auto* cone_twist_joint = static_cast<JoltConeTwistJointImpl3D*>(joint);
 
@@ -2234,6 +3072,8 @@ void JoltPhysicsServer3D::cone_twist_joint_set_jolt_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_CONE_TWIST);
 	auto* cone_twist_joint = static_cast<JoltConeTwistJointImpl3D*>(joint);
 
@@ -2247,6 +3087,8 @@ bool JoltPhysicsServer3D::cone_twist_joint_get_jolt_flag(
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
 	const auto* cone_twist_joint = static_cast<const JoltConeTwistJointImpl3D*>(joint);
 
@@ -2261,6 +3103,8 @@ void JoltPhysicsServer3D::cone_twist_joint_set_jolt_flag(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_CONE_TWIST);
 	auto* cone_twist_joint = static_cast<JoltConeTwistJointImpl3D*>(joint);
 
@@ -2271,6 +3115,8 @@ float JoltPhysicsServer3D::cone_twist_joint_get_applied_force(const RID& p_joint
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
 	auto* cone_twist_joint = static_cast<JoltConeTwistJointImpl3D*>(joint);
 
@@ -2281,6 +3127,8 @@ float JoltPhysicsServer3D::cone_twist_joint_get_applied_torque(const RID& p_join
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_CONE_TWIST);
 	auto* cone_twist_joint = static_cast<JoltConeTwistJointImpl3D*>(joint);
 
@@ -2295,6 +3143,8 @@ double JoltPhysicsServer3D::generic_6dof_joint_get_jolt_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
 	auto* g6dof_joint = static_cast<JoltGeneric6DOFJointImpl3D*>(joint);
 
@@ -2310,6 +3160,8 @@ void JoltPhysicsServer3D::generic_6dof_joint_set_jolt_param(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_6DOF);
 	auto* g6dof_joint = static_cast<JoltGeneric6DOFJointImpl3D*>(joint);
 
@@ -2324,6 +3176,8 @@ bool JoltPhysicsServer3D::generic_6dof_joint_get_jolt_flag(
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
 	const auto* g6dof_joint = static_cast<const JoltGeneric6DOFJointImpl3D*>(joint);
 
@@ -2339,6 +3193,8 @@ void JoltPhysicsServer3D::generic_6dof_joint_set_jolt_flag(
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND(joint->get_type() != JOINT_TYPE_6DOF);
 	auto* g6dof_joint = static_cast<JoltGeneric6DOFJointImpl3D*>(joint);
 
@@ -2349,6 +3205,8 @@ float JoltPhysicsServer3D::generic_6dof_joint_get_applied_force(const RID& p_joi
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
 	auto* g6dof_joint = static_cast<JoltGeneric6DOFJointImpl3D*>(joint);
 
@@ -2359,6 +3217,8 @@ float JoltPhysicsServer3D::generic_6dof_joint_get_applied_torque(const RID& p_jo
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
+	wait_for_step();
+
 	ERR_FAIL_COND_D(joint->get_type() != JOINT_TYPE_6DOF);
 	auto* g6dof_joint = static_cast<JoltGeneric6DOFJointImpl3D*>(joint);
 
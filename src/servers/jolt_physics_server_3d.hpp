@@ -7,11 +7,48 @@ class JoltJointImpl3D;
 class JoltShapeImpl3D;
 class JoltSoftBodyImpl3D;
 class JoltSpace3D;
+class JoltTempAllocatorPool;
 
 class JoltPhysicsServer3D final : public PhysicsServer3DExtension {
 	GDCLASS_NO_WARN(JoltPhysicsServer3D, PhysicsServer3DExtension)
 
 public:
+	enum SpaceParamJolt {
+		SPACE_COLLISION_STEPS = 100,
+		SPACE_MAX_COLLISION_STEPS,
+		SPACE_ADAPTIVE_VELOCITY_THRESHOLD,
+		SPACE_ADAPTIVE_PENETRATION_THRESHOLD,
+		SPACE_POSITION_ITERATIONS
+	};
+
+	enum SpaceFlagJolt {
+		SPACE_FLAG_ADAPTIVE_COLLISION_STEPS = 100,
+		SPACE_FLAG_ALLOW_SLEEPING
+	};
+
+	enum SpaceQualityPresetJolt {
+		SPACE_QUALITY_PRESET_LOW,
+		SPACE_QUALITY_PRESET_DEFAULT,
+		SPACE_QUALITY_PRESET_HIGH
+	};
+
+	enum BodyParamJolt {
+		BODY_CONTACT_REPORT_MIN_VELOCITY = 100,
+		BODY_CONTACT_REPORT_MIN_IMPULSE
+	};
+
+	enum BodyFlagJolt {
+		BODY_FLAG_ESTIMATE_CONTACT_IMPULSES = 100,
+		BODY_FLAG_REPORT_ADDED_CONTACTS_ONLY,
+		BODY_FLAG_REPORT_ONE_CONTACT_PER_PAIR
+	};
+
+	enum AreaMonitorModeJolt {
+		AREA_MONITOR_MODE_SHAPES,
+		AREA_MONITOR_MODE_BODIES,
+		AREA_MONITOR_MODE_OCCUPANCY
+	};
+
 	enum HingeJointParamJolt {
 		HINGE_JOINT_LIMIT_SPRING_FREQUENCY = 100,
 		HINGE_JOINT_LIMIT_SPRING_DAMPING,
@@ -604,7 +641,7 @@ public:
 
 	void _step(double p_step) override;
 
-	void _sync() override { }
+	void _sync() override;
 
 	void _flush_queries() override;
 
@@ -620,6 +657,8 @@ public:
 
 	int32_t _get_process_info(PhysicsServer3D::ProcessInfo p_process_info) override;
 
+	void wait_for_step() const;
+
 	void free_space(JoltSpace3D* p_space);
 
 	void free_area(JoltAreaImpl3D* p_area);
@@ -648,6 +687,52 @@ public:
 	void space_dump_debug_snapshot(const RID& p_space, const String& p_dir);
 #endif // GDJ_CONFIG_EDITOR
 
+	double space_get_jolt_param(const RID& p_space, SpaceParamJolt p_param) const;
+
+	void space_set_jolt_param(const RID& p_space, SpaceParamJolt p_param, double p_value);
+
+	bool space_get_jolt_flag(const RID& p_space, SpaceFlagJolt p_flag) const;
+
+	void space_set_jolt_flag(const RID& p_space, SpaceFlagJolt p_flag, bool p_enabled);
+
+	void space_apply_jolt_quality_preset(const RID& p_space, SpaceQualityPresetJolt p_preset);
+
+	void space_begin_bulk_add(const RID& p_space);
+
+	void space_end_bulk_add(const RID& p_space);
+
+	Dictionary space_get_broad_phase_stats(const RID& p_space) const;
+
+	Dictionary space_get_stats(const RID& p_space) const;
+
+	double body_get_jolt_param(const RID& p_body, BodyParamJolt p_param) const;
+
+	void body_set_jolt_param(const RID& p_body, BodyParamJolt p_param, double p_value);
+
+	bool body_get_jolt_flag(const RID& p_body, BodyFlagJolt p_flag) const;
+
+	void body_set_jolt_flag(const RID& p_body, BodyFlagJolt p_flag, bool p_enabled);
+
+	void area_set_batched_monitor_callback(const RID& p_area, const Callable& p_callback);
+
+	AreaMonitorModeJolt area_get_jolt_monitor_mode(const RID& p_area) const;
+
+	void area_set_jolt_monitor_mode(const RID& p_area, AreaMonitorModeJolt p_mode);
+
+	int32_t area_get_jolt_overlap_count(const RID& p_area) const;
+
+	Dictionary get_job_system_stats() const;
+
+	Dictionary get_temp_memory_stats();
+
+	bool is_profiler_enabled() const;
+
+	void set_profiler_enabled(bool p_enabled);
+
+	String dump_profiler_trace(int32_t p_frame_count);
+
+	Error write_profiler_trace(const String& p_path, int32_t p_frame_count);
+
 	bool joint_get_enabled(const RID& p_joint) const;
 
 	void joint_set_enabled(const RID& p_joint, bool p_enabled);
@@ -746,6 +831,18 @@ public:
 	float generic_6dof_joint_get_applied_torque(const RID& p_joint);
 
 private:
+	static void _step_task(void* p_user_data);
+
+	static void _optimize_broad_phase_task(void* p_user_data, uint32_t p_index);
+
+	void _step_spaces(float p_step);
+
+	void _step_spaces_in_parallel(float p_step);
+
+	void _schedule_broad_phase_optimization(JoltSpace3D* p_space);
+
+	void _start_broad_phase_optimizations();
+
 	mutable RID_PtrOwner<JoltSpace3D> space_owner;
 
 	mutable RID_PtrOwner<JoltAreaImpl3D> area_owner;
@@ -760,13 +857,31 @@ private:
 
 	HashSet<JoltSpace3D*> active_spaces;
 
+	LocalVector<JoltSpace3D*> stepping_spaces;
+
+	mutable LocalVector<JoltSpace3D*> optimizing_spaces;
+
 	JoltJobSystem* job_system = nullptr;
 
+	JoltTempAllocatorPool* temp_allocator_pool = nullptr;
+
+	mutable int64_t step_task_id = -1;
+
+	mutable int64_t optimization_task_id = -1;
+
+	float pending_step = 0.0f;
+
 	bool active = true;
 
 	bool flushing_queries = false;
 };
 
+VARIANT_ENUM_CAST(JoltPhysicsServer3D::SpaceParamJolt)
+VARIANT_ENUM_CAST(JoltPhysicsServer3D::SpaceFlagJolt)
+VARIANT_ENUM_CAST(JoltPhysicsServer3D::SpaceQualityPresetJolt)
+VARIANT_ENUM_CAST(JoltPhysicsServer3D::BodyParamJolt)
+VARIANT_ENUM_CAST(JoltPhysicsServer3D::BodyFlagJolt)
+VARIANT_ENUM_CAST(JoltPhysicsServer3D::AreaMonitorModeJolt)
 VARIANT_ENUM_CAST(JoltPhysicsServer3D::HingeJointParamJolt)
 VARIANT_ENUM_CAST(JoltPhysicsServer3D::HingeJointFlagJolt)
 VARIANT_ENUM_CAST(JoltPhysicsServer3D::SliderJointParamJolt)
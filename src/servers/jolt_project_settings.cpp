@@ -7,6 +7,11 @@ enum JointWorldNode : int32_t {
 	JOINT_WORLD_NODE_B
 };
 
+enum JobSystemThreads : int32_t {
+	JOB_SYSTEM_THREADS_WORKER_POOL,
+	JOB_SYSTEM_THREADS_DEDICATED
+};
+
 constexpr char SLEEP_ENABLED[] = "physics/jolt_3d/sleep/enabled";
 constexpr char SLEEP_VELOCITY_THRESHOLD[] = "physics/jolt_3d/sleep/velocity_threshold";
 constexpr char SLEEP_TIME_THRESHOLD[] = "physics/jolt_3d/sleep/time_threshold";
@@ -16,6 +21,8 @@ constexpr char EDGE_REMOVAL[] = "physics/jolt_3d/collisions/use_enhanced_interna
 constexpr char AREAS_DETECT_STATIC[] = "physics/jolt_3d/collisions/areas_detect_static_bodies";
 constexpr char KINEMATIC_CONTACTS[] = "physics/jolt_3d/collisions/report_all_kinematic_contacts";
 
+constexpr char BROAD_PHASE_THRESHOLD[] = "physics/jolt_3d/broad_phase/optimization_threshold";
+
 constexpr char SOFT_BODY_POINT_MARGIN[] = "physics/jolt_3d/soft_bodies/point_margin";
 
 constexpr char JOINT_WORLD_NODE[] = "physics/jolt_3d/joints/world_node";
@@ -40,6 +47,15 @@ constexpr char MAX_BODIES[] = "physics/jolt_3d/limits/max_bodies";
 constexpr char MAX_PAIRS[] = "physics/jolt_3d/limits/max_body_pairs";
 constexpr char MAX_CONTACTS[] = "physics/jolt_3d/limits/max_contact_constraints";
 constexpr char MAX_TEMP_MEMORY[] = "physics/jolt_3d/limits/max_temporary_memory";
+constexpr char TEMP_MEMORY_TRIM_DELAY[] = "physics/jolt_3d/limits/temporary_memory_trim_delay";
+
+constexpr char USE_HUGE_PAGES[] = "physics/jolt_3d/memory/use_huge_pages";
+
+constexpr char PARALLEL_SPACES[] = "physics/jolt_3d/threading/step_spaces_in_parallel";
+constexpr char JOB_SYSTEM_THREADS[] = "physics/jolt_3d/threading/job_system_threads";
+
+constexpr char PROFILER_ENABLED[] = "physics/jolt_3d/profiler/enabled";
+constexpr char PROFILER_BUFFER_SIZE[] = "physics/jolt_3d/profiler/buffer_size";
 
 constexpr char RUN_ON_SEPARATE_THREAD[] = "physics/3d/run_on_separate_thread";
 constexpr char MAX_THREADS[] = "threading/worker_pool/max_threads";
@@ -143,6 +159,8 @@ void JoltProjectSettings::register_settings() {
 	register_setting_plain(AREAS_DETECT_STATIC, false);
 	register_setting_plain(KINEMATIC_CONTACTS, false);
 
+	register_setting_ranged(BROAD_PHASE_THRESHOLD, 256, U"0,4096,or_greater");
+
 	register_setting_ranged(SOFT_BODY_POINT_MARGIN, 0.01f, U"0,1,0.001,or_greater,suffix:m");
 
 	register_setting_enum(JOINT_WORLD_NODE, JOINT_WORLD_NODE_A, "Node A,Node B");
@@ -167,6 +185,21 @@ void JoltProjectSettings::register_settings() {
 	register_setting_ranged(MAX_PAIRS, 65536, U"8,65536,or_greater");
 	register_setting_ranged(MAX_CONTACTS, 20480, U"8,20480,or_greater");
 	register_setting_ranged(MAX_TEMP_MEMORY, 32, U"1,32,or_greater,suffix:MiB");
+	register_setting_ranged(TEMP_MEMORY_TRIM_DELAY, 600, U"0,3600,or_greater,suffix:steps");
+
+	register_setting_plain(USE_HUGE_PAGES, false, true);
+
+	register_setting_plain(PARALLEL_SPACES, false);
+
+	register_setting_enum(
+		JOB_SYSTEM_THREADS,
+		JOB_SYSTEM_THREADS_WORKER_POOL,
+		"Worker Thread Pool,Dedicated Threads",
+		true
+	);
+
+	register_setting_plain(PROFILER_ENABLED, false);
+	register_setting_ranged(PROFILER_BUFFER_SIZE, 65536, U"1024,1048576,or_greater", true);
 }
 
 bool JoltProjectSettings::is_sleep_enabled() {
@@ -204,6 +237,11 @@ bool JoltProjectSettings::use_enhanced_edge_removal() {
 	return value;
 }
 
+int32_t JoltProjectSettings::get_broad_phase_optimization_threshold() {
+	static const auto value = get_setting<int32_t>(BROAD_PHASE_THRESHOLD);
+	return value;
+}
+
 float JoltProjectSettings::get_soft_body_point_margin() {
 	static const auto value = get_setting<float>(SOFT_BODY_POINT_MARGIN);
 	return value;
@@ -303,7 +341,39 @@ int32_t JoltProjectSettings::get_max_temp_memory_mib() {
 }
 
 int64_t JoltProjectSettings::get_max_temp_memory_b() {
-	static const auto value = get_max_temp_memory_mib() * 1024 * 1024;
+	static const auto value = (int64_t)get_max_temp_memory_mib() * 1024 * 1024;
+	return value;
+}
+
+int32_t JoltProjectSettings::get_temp_memory_trim_delay() {
+	static const auto value = get_setting<int32_t>(TEMP_MEMORY_TRIM_DELAY);
+	return value;
+}
+
+bool JoltProjectSettings::use_huge_pages() {
+	static const auto value = get_setting<bool>(USE_HUGE_PAGES);
+	return value;
+}
+
+bool JoltProjectSettings::should_step_spaces_in_parallel() {
+	static const auto value = get_setting<bool>(PARALLEL_SPACES);
+	return value;
+}
+
+bool JoltProjectSettings::use_dedicated_job_threads() {
+	static const auto value = get_setting<int32_t>(JOB_SYSTEM_THREADS) ==
+		JOB_SYSTEM_THREADS_DEDICATED;
+
+	return value;
+}
+
+bool JoltProjectSettings::is_profiler_enabled() {
+	static const auto value = get_setting<bool>(PROFILER_ENABLED);
+	return value;
+}
+
+int32_t JoltProjectSettings::get_profiler_buffer_size() {
+	static const auto value = get_setting<int32_t>(PROFILER_BUFFER_SIZE);
 	return value;
 }
 
@@ -18,6 +18,8 @@ public:
 
 	static bool use_enhanced_edge_removal();
 
+	static int32_t get_broad_phase_optimization_threshold();
+
 	static float get_soft_body_point_margin();
 
 	static bool use_joint_world_node_a();
@@ -58,6 +60,18 @@ public:
 
 	static int64_t get_max_temp_memory_b();
 
+	static int32_t get_temp_memory_trim_delay();
+
+	static bool use_huge_pages();
+
+	static bool should_step_spaces_in_parallel();
+
+	static bool use_dedicated_job_threads();
+
+	static bool is_profiler_enabled();
+
+	static int32_t get_profiler_buffer_size();
+
 	static bool should_run_on_separate_thread();
 
 	static int32_t get_max_threads();
@@ -2,6 +2,7 @@
 
 #include "objects/jolt_shaped_object_impl_3d.hpp"
 #include "shapes/jolt_custom_user_data_shape.hpp"
+#include "spaces/jolt_profiler.hpp"
 
 namespace {
 
@@ -48,6 +49,8 @@ void JoltShapeImpl3D::set_solver_bias(float p_bias) {
 
 JPH::ShapeRefC JoltShapeImpl3D::try_build() {
 	if (jolt_ref == nullptr) {
+		JOLT_PROFILE_SCOPE("JoltShapeImpl3D::try_build");
+
 		jolt_ref = _build();
 	}
 
@@ -4,25 +4,59 @@
 #include "objects/jolt_body_impl_3d.hpp"
 #include "objects/jolt_soft_body_impl_3d.hpp"
 #include "servers/jolt_project_settings.hpp"
+#include "spaces/jolt_profiler.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
+void JoltContactListener3D::ThreadBuffer::clear() {
+	manifolds.clear();
+	contacts.clear();
+	overlaps.clear();
+	removals.clear();
+}
+
+JoltContactListener3D::~JoltContactListener3D() {
+	for (ThreadBuffer* buffer : thread_buffers) {
+		delete_safely(buffer);
+	}
+}
+
 void JoltContactListener3D::listen_for(JoltShapedObjectImpl3D* p_object) {
 	listening_for.insert(p_object->get_jolt_id());
 }
 
+void JoltContactListener3D::shape_changed(const JoltShapedObjectImpl3D& p_object) {
+	shape_changed_ids.insert(p_object.get_jolt_id());
+}
+
 void JoltContactListener3D::pre_step() {
 	listening_for.clear();
 
+	max_penetration = 0.0f;
+	contact_count = 0;
+
+	// Any buffers still cached by threads from the previous step are now invalid
+	generation = next_generation++;
+
+	tracking_penetration = space->uses_adaptive_collision_steps();
+
+	bounce_velocity_threshold = JoltProjectSettings::get_bounce_velocity_threshold();
+
 #ifdef GDJ_CONFIG_EDITOR
 	debug_contact_count = 0;
 #endif // GDJ_CONFIG_EDITOR
 }
 
 void JoltContactListener3D::post_step() {
+	JOLT_PROFILE_SCOPE("JoltContactListener3D::post_step");
+
+	_merge_events();
+
 	_flush_contacts();
 	_flush_area_shifts();
 	_flush_area_exits();
 	_flush_area_enters();
+
+	_clear_events();
 }
 
 void JoltContactListener3D::OnContactAdded(
@@ -31,10 +65,13 @@ void JoltContactListener3D::OnContactAdded(
 	const JPH::ContactManifold& p_manifold,
 	JPH::ContactSettings& p_settings
 ) {
+	const int32_t sequence = contact_count.fetch_add(1, std::memory_order_relaxed);
+
 	_try_override_collision_response(p_body1, p_body2, p_settings);
 	_try_apply_surface_velocities(p_body1, p_body2, p_settings);
-	_try_add_contacts(p_body1, p_body2, p_manifold, p_settings);
-	_try_evaluate_area_overlap(p_body1, p_body2, p_manifold);
+	_try_add_contacts(p_body1, p_body2, p_manifold, p_settings, false, sequence);
+	_try_evaluate_area_overlap(p_body1, p_body2, p_manifold, sequence);
+	_try_track_penetration(p_body1, p_body2, p_manifold);
 
 #ifdef GDJ_CONFIG_EDITOR
 	_try_add_debug_contacts(p_body1, p_body2, p_manifold);
@@ -47,10 +84,13 @@ void JoltContactListener3D::OnContactPersisted(
 	const JPH::ContactManifold& p_manifold,
 	JPH::ContactSettings& p_settings
 ) {
+	const int32_t sequence = contact_count.fetch_add(1, std::memory_order_relaxed);
+
 	_try_override_collision_response(p_body1, p_body2, p_settings);
 	_try_apply_surface_velocities(p_body1, p_body2, p_settings);
-	_try_add_contacts(p_body1, p_body2, p_manifold, p_settings);
-	_try_evaluate_area_overlap(p_body1, p_body2, p_manifold);
+	_try_add_contacts(p_body1, p_body2, p_manifold, p_settings, true, sequence);
+	_try_evaluate_area_overlap(p_body1, p_body2, p_manifold, sequence);
+	_try_track_penetration(p_body1, p_body2, p_manifold);
 
 #ifdef GDJ_CONFIG_EDITOR
 	_try_add_debug_contacts(p_body1, p_body2, p_manifold);
@@ -58,9 +98,11 @@ void JoltContactListener3D::OnContactPersisted(
 }
 
 void JoltContactListener3D::OnContactRemoved(const JPH::SubShapeIDPair& p_shape_pair) {
-	if (!_try_remove_contacts(p_shape_pair)) {
-		_try_remove_area_overlap(p_shape_pair);
-	}
+	// Removals are only ever reported in between collision steps, so every contact reported so far
+	// happened before this removal, and any contact reported after it will get a higher sequence.
+	RemovalEvent& event = _get_thread_buffer().removals.emplace_back();
+	event.shape_pair = p_shape_pair;
+	event.sequence = contact_count.load(std::memory_order_relaxed);
 }
 
 JPH::SoftBodyValidateResult JoltContactListener3D::OnSoftBodyContactValidate(
@@ -204,50 +246,64 @@ bool JoltContactListener3D::_try_add_contacts(
 	const JPH::Body& p_body1,
 	const JPH::Body& p_body2,
 	const JPH::ContactManifold& p_manifold,
-	JPH::ContactSettings& p_settings
+	JPH::ContactSettings& p_settings,
+	bool p_persisted,
+	int32_t p_sequence
 ) {
 	if (p_body1.IsSensor() || p_body2.IsSensor()) {
 		return false;
 	}
 
-	if (!_is_listening_for(p_body1) && !_is_listening_for(p_body2)) {
+	const auto* body1 = reinterpret_cast<const JoltBodyImpl3D*>(p_body1.GetUserData());
+	const auto* body2 = reinterpret_cast<const JoltBodyImpl3D*>(p_body2.GetUserData());
+
+	auto wants_contact = [&](const JPH::Body& p_jolt_body, const JoltBodyImpl3D& p_body) {
+		if (!_is_listening_for(p_jolt_body)) {
+			return false;
+		}
+
+		return !p_persisted || !p_body.reports_added_contacts_only();
+	};
+
+	bool report1 = wants_contact(p_body1, *body1);
+	bool report2 = wants_contact(p_body2, *body2);
+
+	if (!report1 && !report2) {
 		return false;
 	}
 
-	const JPH::SubShapeIDPair shape_pair(
-		p_body1.GetID(),
-		p_manifold.mSubShapeID1,
-		p_body2.GetID(),
-		p_manifold.mSubShapeID2
-	);
+	// Estimating the impulses is by far the most expensive part of reporting contacts, so we only
+	// do it when one of the bodies has actually asked for them
+	const bool estimate_impulses = (report1 && body1->estimates_contact_impulses()) ||
+		(report2 && body2->estimates_contact_impulses());
 
-	auto& manifold = [&]() -> Manifold& {
-		const MutexLock write_lock(write_mutex);
-		return manifolds_by_shape_pair[shape_pair];
-	}();
+	JPH::CollisionEstimationResult collision;
 
-	const JPH::uint contact_count = p_manifold.mRelativeContactPointsOn1.size();
+	if (estimate_impulses) {
+		JPH::EstimateCollisionResponse(
+			p_body1,
+			p_body2,
+			p_manifold,
+			collision,
+			p_settings.mCombinedFriction,
+			p_settings.mCombinedRestitution,
+			bounce_velocity_threshold,
+			5
+		);
+	}
 
-	manifold.contacts1.reserve((int32_t)contact_count);
-	manifold.contacts2.reserve((int32_t)contact_count);
-	manifold.depth = p_manifold.mPenetrationDepth;
+	ThreadBuffer& buffer = _get_thread_buffer();
 
-	JPH::CollisionEstimationResult collision;
+	const JPH::uint point_count = p_manifold.mRelativeContactPointsOn1.size();
+	const auto contacts_begin = (int32_t)buffer.contacts.size();
 
-	JPH::EstimateCollisionResponse(
-		p_body1,
-		p_body2,
-		p_manifold,
-		collision,
-		p_settings.mCombinedFriction,
-		p_settings.mCombinedRestitution,
-		JoltProjectSettings::get_bounce_velocity_threshold(),
-		5
-	);
+	float approach_velocity = -FLT_MAX;
+	float normal_impulse = 0.0f;
+	JPH::Vec3 total_impulse = JPH::Vec3::sZero();
+	int32_t fastest_contact = contacts_begin;
 
-	for (JPH::uint i = 0; i < contact_count; ++i) {
-		Contact& contact1 = manifold.contacts1.emplace_back();
-		Contact& contact2 = manifold.contacts2.emplace_back();
+	for (JPH::uint i = 0; i < point_count; ++i) {
+		Contact& contact = buffer.contacts.emplace_back();
 
 		const auto relative_point1 = JPH::RVec3(p_manifold.mRelativeContactPointsOn1[i]);
 		const auto relative_point2 = JPH::RVec3(p_manifold.mRelativeContactPointsOn2[i]);
@@ -258,6 +314,24 @@ bool JoltContactListener3D::_try_add_contacts(
 		const JPH::Vec3 velocity1 = p_body1.GetPointVelocity(world_point1);
 		const JPH::Vec3 velocity2 = p_body2.GetPointVelocity(world_point2);
 
+		contact.normal = -p_manifold.mWorldSpaceNormal;
+		contact.point_self = world_point1;
+		contact.point_other = world_point2;
+		contact.velocity_self = velocity1;
+		contact.velocity_other = velocity2;
+
+		const JPH::Vec3 relative_velocity = velocity1 - velocity2;
+		const float point_approach_velocity = relative_velocity.Dot(p_manifold.mWorldSpaceNormal);
+
+		if (point_approach_velocity > approach_velocity) {
+			approach_velocity = point_approach_velocity;
+			fastest_contact = contacts_begin + (int32_t)i;
+		}
+
+		if (!estimate_impulses) {
+			continue;
+		}
+
 		const JPH::CollisionEstimationResult::Impulse& impulse = collision.mImpulses[i];
 
 		const JPH::Vec3 contact_impulse = p_manifold.mWorldSpaceNormal * impulse.mContactImpulse;
@@ -265,46 +339,80 @@ bool JoltContactListener3D::_try_add_contacts(
 		const JPH::Vec3 friction_impulse2 = collision.mTangent2 * impulse.mFrictionImpulse2;
 		const JPH::Vec3 combined_impulse = contact_impulse + friction_impulse1 + friction_impulse2;
 
-		contact1.normal = -p_manifold.mWorldSpaceNormal;
-		contact1.point_self = world_point1;
-		contact1.point_other = world_point2;
-		contact1.velocity_self = velocity1;
-		contact1.velocity_other = velocity2;
-		contact1.impulse = -combined_impulse;
+		contact.impulse = -combined_impulse;
 
-		contact2.normal = p_manifold.mWorldSpaceNormal;
-		contact2.point_self = world_point2;
-		contact2.point_other = world_point1;
-		contact2.velocity_self = velocity2;
-		contact2.velocity_other = velocity1;
-		contact2.impulse = combined_impulse;
+		normal_impulse += impulse.mContactImpulse;
+		total_impulse += contact.impulse;
 	}
 
+	report1 = report1 && body1->passes_contact_report_thresholds(approach_velocity, normal_impulse);
+	report2 = report2 && body2->passes_contact_report_thresholds(approach_velocity, normal_impulse);
+
+	if (!report1 && !report2) {
+		buffer.contacts.resize(contacts_begin);
+		return false;
+	}
+
+	const bool single1 = report1 && body1->reports_one_contact_per_pair();
+	const bool single2 = report2 && body2->reports_one_contact_per_pair();
+
+	const bool all1 = report1 && !single1;
+	const bool all2 = report2 && !single2;
+
+	const ContactRange all_contacts = {contacts_begin, (int32_t)point_count};
+	ContactRange single_contact;
+
+	// Bodies that only want one contact per pair get the fastest approaching point of the manifold,
+	// carrying the impulse of the whole manifold. It either replaces the other points entirely or
+	// gets stored after them, depending on whether the other body still wants all of them.
+	if (single1 || single2) {
+		Contact contact = buffer.contacts[fastest_contact];
+		contact.impulse = total_impulse;
+
+		if (all1 || all2) {
+			single_contact = {(int32_t)buffer.contacts.size(), 1};
+			buffer.contacts.push_back(contact);
+		} else {
+			buffer.contacts.resize(contacts_begin + 1);
+			buffer.contacts[contacts_begin] = contact;
+			single_contact = {contacts_begin, 1};
+		}
+	}
+
+	ManifoldEvent& manifold = buffer.manifolds.emplace_back();
+	manifold.shape_pair = JPH::SubShapeIDPair(
+		p_body1.GetID(),
+		p_manifold.mSubShapeID1,
+		p_body2.GetID(),
+		p_manifold.mSubShapeID2
+	);
+	manifold.depth = p_manifold.mPenetrationDepth;
+	manifold.sequence = p_sequence;
+	manifold.contacts1 = single1 ? single_contact : (all1 ? all_contacts : ContactRange());
+	manifold.contacts2 = single2 ? single_contact : (all2 ? all_contacts : ContactRange());
+
 	return true;
 }
 
 bool JoltContactListener3D::_try_evaluate_area_overlap(
 	const JPH::Body& p_body1,
 	const JPH::Body& p_body2,
-	const JPH::ContactManifold& p_manifold
+	const JPH::ContactManifold& p_manifold,
+	int32_t p_sequence
 ) {
 	if (!p_body1.IsSensor() && !p_body2.IsSensor()) {
 		return false;
 	}
 
-	auto evaluate = [&](auto&& p_area, auto&& p_object, const JPH::SubShapeIDPair& p_shape_pair) {
-		const MutexLock write_lock(write_mutex);
+	ThreadBuffer& buffer = _get_thread_buffer();
 
-		if (p_area.can_monitor(p_object)) {
-			if (!area_overlaps.has(p_shape_pair)) {
-				area_overlaps.insert(p_shape_pair);
-				area_enters.insert(p_shape_pair);
-			}
-		} else {
-			if (area_overlaps.erase(p_shape_pair)) {
-				area_exits.insert(p_shape_pair);
-			}
-		}
+	auto evaluate = [&](auto&& p_area, auto&& p_object, const JPH::SubShapeIDPair& p_shape_pair) {
+		OverlapEvent& event = buffer.overlaps.emplace_back();
+		event.shape_pair = p_shape_pair;
+		event.sequence = p_sequence;
+		event.type = p_area.can_monitor(p_object)
+			? OVERLAP_EVENT_OVERLAPPING
+			: OVERLAP_EVENT_IGNORED;
 	};
 
 	const JPH::SubShapeIDPair shape_pair1(
@@ -342,35 +450,58 @@ bool JoltContactListener3D::_try_evaluate_area_overlap(
 	return true;
 }
 
-bool JoltContactListener3D::_try_remove_contacts(const JPH::SubShapeIDPair& p_shape_pair) {
-	const MutexLock write_lock(write_mutex);
+bool JoltContactListener3D::_try_track_penetration(
+	const JPH::Body& p_body1,
+	const JPH::Body& p_body2,
+	const JPH::ContactManifold& p_manifold
+) {
+	if (!tracking_penetration) {
+		return false;
+	}
 
-	return manifolds_by_shape_pair.erase(p_shape_pair);
-}
+	if (p_body1.IsSensor() || p_body2.IsSensor()) {
+		return false;
+	}
 
-bool JoltContactListener3D::_try_remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair) {
-	const JPH::SubShapeIDPair swapped_shape_pair(
-		p_shape_pair.GetBody2ID(),
-		p_shape_pair.GetSubShapeID2(),
-		p_shape_pair.GetBody1ID(),
-		p_shape_pair.GetSubShapeID1()
-	);
+	const float depth = p_manifold.mPenetrationDepth;
 
-	const MutexLock write_lock(write_mutex);
+	float current_max = max_penetration.load(std::memory_order_relaxed);
 
-	bool removed = false;
+	while (depth > current_max) {
+		if (max_penetration.compare_exchange_weak(current_max, depth, std::memory_order_relaxed)) {
+			break;
+		}
+	}
 
-	if (area_overlaps.erase(p_shape_pair)) {
-		area_exits.insert(p_shape_pair);
-		removed = true;
+	return true;
+}
+
+JoltContactListener3D::ThreadBuffer& JoltContactListener3D::_get_thread_buffer() {
+	ThreadBufferCache& cache = thread_buffer_cache;
+
+	// Generations are unique across all listeners, so a matching one also means it's our buffer
+	for (const ThreadBufferCacheEntry& entry : cache.entries) {
+		if (entry.generation == generation) {
+			return *entry.buffer;
+		}
 	}
 
-	if (area_overlaps.erase(swapped_shape_pair)) {
-		area_exits.insert(swapped_shape_pair);
-		removed = true;
+	// When stepping spaces in parallel the same thread can end up going back and forth between the
+	// listeners of different spaces, so we keep several of them cached, or we would end up claiming
+	// a new buffer every time the thread came back to one of them.
+	ThreadBufferCacheEntry& entry = cache.entries[cache.next_index];
+	cache.next_index = (cache.next_index + 1) % THREAD_BUFFER_CACHE_SIZE;
+
+	const MutexLock thread_buffers_lock(thread_buffers_mutex);
+
+	if (thread_buffer_count == (int32_t)thread_buffers.size()) {
+		thread_buffers.push_back(new ThreadBuffer());
 	}
 
-	return removed;
+	entry.buffer = thread_buffers[thread_buffer_count++];
+	entry.generation = generation;
+
+	return *entry.buffer;
 }
 
 #ifdef GDJ_CONFIG_EDITOR
@@ -469,57 +600,291 @@ bool JoltContactListener3D::_try_add_debug_contacts(
 
 #endif // GDJ_CONFIG_EDITOR
 
-void JoltContactListener3D::_flush_contacts() {
-	for (auto&& [shape_pair, manifold] : manifolds_by_shape_pair) {
-		const JPH::BodyID body_ids[] = {shape_pair.GetBody1ID(), shape_pair.GetBody2ID()};
+void JoltContactListener3D::_merge_events() {
+	JOLT_PROFILE_SCOPE("JoltContactListener3D::_merge_events");
+
+	// With multiple collision steps the same shape pair can be reported more than once, in which
+	// case we keep the most recent manifold that actually had contacts for each of the bodies. A
+	// body that only wants added contacts, or whose thresholds were only passed in an earlier
+	// collision step, would otherwise lose its contacts to a later manifold without any for it.
+	for (int32_t i = 0; i < thread_buffer_count; ++i) {
+		const ThreadBuffer& buffer = *thread_buffers[i];
+
+		for (const ManifoldEvent& event : buffer.manifolds) {
+			const int32_t* existing_index = merged_indices_by_shape_pair.getptr(event.shape_pair);
+			auto index = (int32_t)merged_manifolds.size();
+
+			if (existing_index != nullptr) {
+				index = *existing_index;
+			} else {
+				merged_indices_by_shape_pair.insert(event.shape_pair, index);
+				merged_manifolds.push_back({});
+			}
 
-		const JoltReadableBodies3D jolt_bodies = space->read_bodies(body_ids, count_of(body_ids));
+			MergedManifold& merged = merged_manifolds[index];
+
+			auto merge_side = [&](MergedSide& p_side, const ContactRange& p_contacts) {
+				if (p_contacts.count == 0) {
+					return;
+				}
+
+				if (p_side.event == nullptr || event.sequence > p_side.event->sequence) {
+					p_side = {&event, &buffer};
+				}
+			};
 
-		JoltBodyImpl3D* body1 = jolt_bodies[0].as_body();
-		ERR_FAIL_NULL(body1);
+			merge_side(merged.side1, event.contacts1);
+			merge_side(merged.side2, event.contacts2);
+		}
+	}
+
+	// A shape pair that separated in a later collision step no longer has any contacts to report
+	for (int32_t i = 0; i < thread_buffer_count; ++i) {
+		for (const RemovalEvent& removal : thread_buffers[i]->removals) {
+			const int32_t* index = merged_indices_by_shape_pair.getptr(removal.shape_pair);
 
-		JoltBodyImpl3D* body2 = jolt_bodies[1].as_body();
-		ERR_FAIL_NULL(body2);
+			if (index == nullptr) {
+				continue;
+			}
 
-		const int32_t shape_index1 = body1->find_shape_index(shape_pair.GetSubShapeID1());
-		const int32_t shape_index2 = body2->find_shape_index(shape_pair.GetSubShapeID2());
+			MergedManifold& merged = merged_manifolds[*index];
 
-		for (const Contact& contact : manifold.contacts1) {
-			body1->add_contact(
-				body2,
-				manifold.depth,
-				shape_index1,
-				shape_index2,
-				to_godot(contact.normal),
-				to_godot(contact.point_self),
-				to_godot(contact.point_other),
-				to_godot(contact.velocity_self),
-				to_godot(contact.velocity_other),
-				to_godot(contact.impulse)
+			auto remove_side = [&](MergedSide& p_side) {
+				if (p_side.event != nullptr && p_side.event->sequence < removal.sequence) {
+					p_side = {};
+				}
+			};
+
+			remove_side(merged.side1);
+			remove_side(merged.side2);
+		}
+	}
+
+	_merge_overlap_events();
+}
+
+void JoltContactListener3D::_merge_overlap_events() {
+	for (int32_t i = 0; i < thread_buffer_count; ++i) {
+		for (const OverlapEvent& event : thread_buffers[i]->overlaps) {
+			overlap_events.push_back(event);
+		}
+	}
+
+	const bool had_overlap_events = !overlap_events.is_empty();
+
+	for (int32_t i = 0; i < thread_buffer_count; ++i) {
+		for (const RemovalEvent& removal : thread_buffers[i]->removals) {
+			const JPH::SubShapeIDPair& shape_pair = removal.shape_pair;
+
+			const JPH::SubShapeIDPair swapped_shape_pair(
+				shape_pair.GetBody2ID(),
+				shape_pair.GetSubShapeID2(),
+				shape_pair.GetBody1ID(),
+				shape_pair.GetSubShapeID1()
 			);
+
+			// Most removals are for regular contacts, so unless there were overlaps reported during
+			// this step we can discard any removal that doesn't refer to an existing overlap.
+			if (!had_overlap_events && !area_overlaps.has(shape_pair) &&
+				!area_overlaps.has(swapped_shape_pair))
+			{
+				continue;
+			}
+
+			OverlapEvent& event = overlap_events.emplace_back();
+			event.shape_pair = shape_pair;
+			event.sequence = removal.sequence;
+			event.type = OVERLAP_EVENT_REMOVED;
 		}
+	}
 
-		for (const Contact& contact : manifold.contacts2) {
-			body2->add_contact(
-				body1,
-				manifold.depth,
-				shape_index2,
-				shape_index1,
-				to_godot(contact.normal),
-				to_godot(contact.point_self),
-				to_godot(contact.point_other),
-				to_godot(contact.velocity_self),
-				to_godot(contact.velocity_other),
-				to_godot(contact.impulse)
+	// Removals happen in between collision steps, so for equal sequences they come first
+	overlap_events.sort([](const OverlapEvent& p_lhs, const OverlapEvent& p_rhs) {
+		if (p_lhs.sequence != p_rhs.sequence) {
+			return p_lhs.sequence < p_rhs.sequence;
+		}
+
+		return p_lhs.type == OVERLAP_EVENT_REMOVED && p_rhs.type != OVERLAP_EVENT_REMOVED;
+	});
+
+	for (const OverlapEvent& event : overlap_events) {
+		_apply_overlap_event(event);
+	}
+}
+
+void JoltContactListener3D::_apply_overlap_event(const OverlapEvent& p_event) {
+	const JPH::SubShapeIDPair& shape_pair = p_event.shape_pair;
+
+	switch (p_event.type) {
+		case OVERLAP_EVENT_REMOVED: {
+			const JPH::SubShapeIDPair swapped_shape_pair(
+				shape_pair.GetBody2ID(),
+				shape_pair.GetSubShapeID2(),
+				shape_pair.GetBody1ID(),
+				shape_pair.GetSubShapeID1()
 			);
+
+			if (area_overlaps.erase(shape_pair)) {
+				area_exits.insert(shape_pair);
+			}
+
+			if (area_overlaps.erase(swapped_shape_pair)) {
+				area_exits.insert(swapped_shape_pair);
+			}
+		} break;
+		case OVERLAP_EVENT_OVERLAPPING: {
+			if (!area_overlaps.has(shape_pair)) {
+				area_overlaps.insert(shape_pair);
+				area_enters.insert(shape_pair);
+			}
+		} break;
+		case OVERLAP_EVENT_IGNORED: {
+			if (area_overlaps.erase(shape_pair)) {
+				area_exits.insert(shape_pair);
+			}
+		} break;
+	}
+}
+
+void JoltContactListener3D::_clear_events() {
+	for (int32_t i = 0; i < thread_buffer_count; ++i) {
+		thread_buffers[i]->clear();
+	}
+
+	thread_buffer_count = 0;
+
+	merged_manifolds.clear();
+	merged_indices_by_shape_pair.clear();
+	overlap_events.clear();
+}
+
+void JoltContactListener3D::_flush_contacts() {
+	JOLT_PROFILE_SCOPE("JoltContactListener3D::_flush_contacts");
+
+	body_manifolds.clear();
+	flushed_body_ids.clear();
+
+	for (const MergedManifold& merged : merged_manifolds) {
+		const ManifoldEvent* manifold = merged.side1.event != nullptr
+			? merged.side1.event
+			: merged.side2.event;
+
+		if (manifold == nullptr) {
+			continue;
 		}
 
-		manifold.contacts1.clear();
-		manifold.contacts2.clear();
+		const JPH::BodyID& body_id1 = manifold->shape_pair.GetBody1ID();
+		const JPH::BodyID& body_id2 = manifold->shape_pair.GetBody2ID();
+
+		if (merged.side1.event != nullptr) {
+			body_manifolds.push_back({body_id1, &merged.side1, false});
+		}
+
+		if (merged.side2.event != nullptr) {
+			body_manifolds.push_back({body_id2, &merged.side2, true});
+		}
+
+		flushed_body_ids.push_back(body_id1);
+		flushed_body_ids.push_back(body_id2);
+	}
+
+	if (body_manifolds.is_empty()) {
+		return;
+	}
+
+	// Grouping the manifolds by the body they're reported to lets us resolve every body only once,
+	// and have all of its contacts written one after the other
+	body_manifolds.sort([](const BodyManifold& p_lhs, const BodyManifold& p_rhs) {
+		return p_lhs.body_id < p_rhs.body_id;
+	});
+
+	flushed_body_ids.sort();
+
+	const auto unique_end = std::unique(flushed_body_ids.begin(), flushed_body_ids.end());
+	flushed_body_ids.resize((int32_t)std::distance(flushed_body_ids.begin(), unique_end));
+
+	const JPH::BodyID* body_ids = flushed_body_ids.ptr();
+	const int32_t body_count = flushed_body_ids.size();
+
+	const JoltScopedBodyReader3D jolt_bodies(*space, body_ids, body_count);
+
+	auto find_body = [&](const JPH::BodyID& p_body_id) -> JoltBodyImpl3D* {
+		const JPH::BodyID* found_id = std::lower_bound(body_ids, body_ids + body_count, p_body_id);
+		const auto index = (int32_t)(found_id - body_ids);
+
+		const JPH::Body* jolt_body = jolt_bodies.try_get(index);
+		ERR_FAIL_NULL_V(jolt_body, nullptr);
+
+		auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
+
+		return object->as_body();
+	};
+
+	JPH::BodyID body_id;
+	JoltBodyImpl3D* body = nullptr;
+
+	for (const BodyManifold& body_manifold : body_manifolds) {
+		if (body_manifold.body_id != body_id) {
+			body_id = body_manifold.body_id;
+			body = find_body(body_id);
+		}
+
+		if (body == nullptr) {
+			continue;
+		}
+
+		const ManifoldEvent& manifold = *body_manifold.side->event;
+		const LocalVector<Contact>& contacts = body_manifold.side->buffer->contacts;
+
+		const JPH::SubShapeIDPair& shape_pair = manifold.shape_pair;
+
+		// Contacts are stored from the perspective of the first body, so we flip them for the
+		// second one
+		const bool swapped = body_manifold.swapped;
+		const float sign = swapped ? -1.0f : 1.0f;
+
+		const JPH::BodyID& collider_id = swapped
+			? shape_pair.GetBody1ID()
+			: shape_pair.GetBody2ID();
+
+		JoltBodyImpl3D* collider = find_body(collider_id);
+		ERR_CONTINUE(collider == nullptr);
+
+		const JPH::SubShapeID& sub_shape_id = swapped
+			? shape_pair.GetSubShapeID2()
+			: shape_pair.GetSubShapeID1();
+
+		const JPH::SubShapeID& collider_sub_shape_id = swapped
+			? shape_pair.GetSubShapeID1()
+			: shape_pair.GetSubShapeID2();
+
+		const int32_t shape_index = body->find_shape_index(sub_shape_id);
+		const int32_t collider_shape_index = collider->find_shape_index(collider_sub_shape_id);
+
+		const ContactRange& range = swapped ? manifold.contacts2 : manifold.contacts1;
+
+		for (int32_t i = range.begin; i < range.begin + range.count; ++i) {
+			const Contact& contact = contacts[i];
+
+			body->add_contact(
+				*collider,
+				manifold.depth,
+				shape_index,
+				collider_shape_index,
+				contact.normal * sign,
+				swapped ? contact.point_other : contact.point_self,
+				swapped ? contact.point_self : contact.point_other,
+				swapped ? contact.velocity_other : contact.velocity_self,
+				swapped ? contact.velocity_self : contact.velocity_other,
+				contact.impulse * sign
+			);
+		}
 	}
 }
 
 void JoltContactListener3D::_flush_area_enters() {
+	JOLT_PROFILE_SCOPE("JoltContactListener3D::_flush_area_enters");
+
 	for (const JPH::SubShapeIDPair& shape_pair : area_enters) {
 		const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
 		const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
@@ -554,8 +919,24 @@ void JoltContactListener3D::_flush_area_enters() {
 }
 
 void JoltContactListener3D::_flush_area_shifts() {
+	JOLT_PROFILE_SCOPE("JoltContactListener3D::_flush_area_shifts");
+
+	// Sub-shape IDs can only end up referring to different shapes when a shape is rebuilt, so
+	// unless that happened since the last step there's no need to look at any of the overlaps
+	if (shape_changed_ids.is_empty()) {
+		return;
+	}
+
+	ON_SCOPE_EXIT {
+		shape_changed_ids.clear();
+	};
+
 	for (const JPH::SubShapeIDPair& shape_pair : area_overlaps) {
 		auto is_shifted = [&](const JPH::BodyID& p_body_id, const JPH::SubShapeID& p_sub_shape_id) {
+			if (!shape_changed_ids.has(p_body_id)) {
+				return false;
+			}
+
 			const JoltReadableBody3D jolt_body = space->read_body(p_body_id);
 			const JoltShapedObjectImpl3D* object = jolt_body.as_shaped();
 			ERR_FAIL_NULL_V(object, false);
@@ -583,6 +964,8 @@ void JoltContactListener3D::_flush_area_shifts() {
 }
 
 void JoltContactListener3D::_flush_area_exits() {
+	JOLT_PROFILE_SCOPE("JoltContactListener3D::_flush_area_exits");
+
 	for (const JPH::SubShapeIDPair& shape_pair : area_exits) {
 		const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
 		const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
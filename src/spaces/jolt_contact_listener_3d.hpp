@@ -10,6 +10,9 @@ class JoltContactListener3D final
 
 	using MutexLock = std::unique_lock<Mutex>;
 
+	// How many listeners each thread keeps its buffer cached for at the same time
+	static constexpr int32_t THREAD_BUFFER_CACHE_SIZE = 8;
+
 	struct BodyIDHasher {
 		static uint32_t hash(const JPH::BodyID& p_id) {
 			return hash_fmix32(p_id.GetIndexAndSequenceNumber());
@@ -26,6 +29,7 @@ class JoltContactListener3D final
 		}
 	};
 
+	// Stored from the perspective of the first body, since the second one's can be derived from it
 	struct Contact {
 		JPH::Vec3 normal = {};
 
@@ -40,32 +44,124 @@ class JoltContactListener3D final
 		JPH::Vec3 impulse = {};
 	};
 
-	using Contacts = LocalVector<Contact>;
+	struct ContactRange {
+		int32_t begin = 0;
 
-	struct Manifold {
-		Contacts contacts1;
+		int32_t count = 0;
+	};
 
-		Contacts contacts2;
+	// The sequence numbers of the events let us restore the order in which they happened across
+	// threads, which matters when there are multiple collision steps per physics step. Each body
+	// gets its own range of contacts, since their contact report filters might differ.
+	struct ManifoldEvent {
+		JPH::SubShapeIDPair shape_pair;
 
 		float depth = 0.0f;
+
+		int32_t sequence = 0;
+
+		ContactRange contacts1;
+
+		ContactRange contacts2;
+	};
+
+	enum OverlapEventType : int32_t {
+		OVERLAP_EVENT_REMOVED,
+		OVERLAP_EVENT_OVERLAPPING,
+		OVERLAP_EVENT_IGNORED
+	};
+
+	struct OverlapEvent {
+		JPH::SubShapeIDPair shape_pair;
+
+		int32_t sequence = 0;
+
+		OverlapEventType type = OVERLAP_EVENT_REMOVED;
+	};
+
+	struct RemovalEvent {
+		JPH::SubShapeIDPair shape_pair;
+
+		int32_t sequence = 0;
+	};
+
+	struct ThreadBuffer {
+		void clear();
+
+		LocalVector<ManifoldEvent> manifolds;
+
+		LocalVector<Contact> contacts;
+
+		LocalVector<OverlapEvent> overlaps;
+
+		LocalVector<RemovalEvent> removals;
+	};
+
+	struct ThreadBufferCacheEntry {
+		ThreadBuffer* buffer = nullptr;
+
+		uint64_t generation = 0;
+	};
+
+	struct ThreadBufferCache {
+		ThreadBufferCacheEntry entries[THREAD_BUFFER_CACHE_SIZE];
+
+		int32_t next_index = 0;
+	};
+
+	// The most recent manifold event that had any contacts to report to one of the bodies
+	struct MergedSide {
+		const ManifoldEvent* event = nullptr;
+
+		const ThreadBuffer* buffer = nullptr;
+	};
+
+	// Each body is merged separately, since a later collision step might not have any contacts to
+	// report to one of them, due to things like their contact report filters, in which case we
+	// want to hold on to whatever was reported to it in an earlier collision step.
+	struct MergedManifold {
+		MergedSide side1;
+
+		MergedSide side2;
+	};
+
+	// One side of a merged manifold, as seen from the body that its contacts are reported to
+	struct BodyManifold {
+		JPH::BodyID body_id;
+
+		const MergedSide* side = nullptr;
+
+		bool swapped = false;
 	};
 
 	using BodyIDs = HashSet<JPH::BodyID, BodyIDHasher>;
 
 	using Overlaps = HashSet<JPH::SubShapeIDPair, ShapePairHasher>;
 
-	using ManifoldsByShapePair = HashMap<JPH::SubShapeIDPair, Manifold, ShapePairHasher>;
+	using IndicesByShapePair = HashMap<JPH::SubShapeIDPair, int32_t, ShapePairHasher>;
 
 public:
 	explicit JoltContactListener3D(JoltSpace3D* p_space)
 		: space(p_space) { }
 
+	JoltContactListener3D(const JoltContactListener3D& p_other) = delete;
+
+	JoltContactListener3D(JoltContactListener3D&& p_other) = delete;
+
+	~JoltContactListener3D() override;
+
 	void listen_for(JoltShapedObjectImpl3D* p_object);
 
+	void shape_changed(const JoltShapedObjectImpl3D& p_object);
+
 	void pre_step();
 
 	void post_step();
 
+	float get_max_penetration() const { return max_penetration; }
+
+	int32_t get_contact_count() const { return contact_count; }
+
 #ifdef GDJ_CONFIG_EDITOR
 	const PackedVector3Array& get_debug_contacts() const { return debug_contacts; }
 
@@ -76,6 +172,10 @@ public:
 	void set_max_debug_contacts(int32_t p_count) { debug_contacts.resize(p_count); }
 #endif // GDJ_CONFIG_EDITOR
 
+	JoltContactListener3D& operator=(const JoltContactListener3D& p_other) = delete;
+
+	JoltContactListener3D& operator=(JoltContactListener3D&& p_other) = delete;
+
 private:
 	void OnContactAdded(
 		const JPH::Body& p_body1,
@@ -130,18 +230,25 @@ private:
 		const JPH::Body& p_body1,
 		const JPH::Body& p_body2,
 		const JPH::ContactManifold& p_manifold,
-		JPH::ContactSettings& p_settings
+		JPH::ContactSettings& p_settings,
+		bool p_persisted,
+		int32_t p_sequence
 	);
 
 	bool _try_evaluate_area_overlap(
 		const JPH::Body& p_body1,
 		const JPH::Body& p_body2,
-		const JPH::ContactManifold& p_manifold
+		const JPH::ContactManifold& p_manifold,
+		int32_t p_sequence
 	);
 
-	bool _try_remove_contacts(const JPH::SubShapeIDPair& p_shape_pair);
+	bool _try_track_penetration(
+		const JPH::Body& p_body1,
+		const JPH::Body& p_body2,
+		const JPH::ContactManifold& p_manifold
+	);
 
-	bool _try_remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair);
+	ThreadBuffer& _get_thread_buffer();
 
 #ifdef GDJ_CONFIG_EDITOR
 	bool _try_add_debug_contacts(
@@ -156,6 +263,14 @@ private:
 	);
 #endif // GDJ_CONFIG_EDITOR
 
+	void _merge_events();
+
+	void _merge_overlap_events();
+
+	void _apply_overlap_event(const OverlapEvent& p_event);
+
+	void _clear_events();
+
 	void _flush_contacts();
 
 	void _flush_area_enters();
@@ -164,7 +279,21 @@ private:
 
 	void _flush_area_exits();
 
-	ManifoldsByShapePair manifolds_by_shape_pair;
+	inline static thread_local ThreadBufferCache thread_buffer_cache;
+
+	inline static std::atomic<uint64_t> next_generation = 1;
+
+	LocalVector<ThreadBuffer*> thread_buffers;
+
+	LocalVector<MergedManifold> merged_manifolds;
+
+	LocalVector<BodyManifold> body_manifolds;
+
+	LocalVector<JPH::BodyID> flushed_body_ids;
+
+	LocalVector<OverlapEvent> overlap_events;
+
+	IndicesByShapePair merged_indices_by_shape_pair;
 
 	BodyIDs listening_for;
 
@@ -174,10 +303,24 @@ private:
 
 	Overlaps area_exits;
 
-	Mutex write_mutex;
+	BodyIDs shape_changed_ids;
+
+	Mutex thread_buffers_mutex;
 
 	JoltSpace3D* space = nullptr;
 
+	uint64_t generation = 0;
+
+	int32_t thread_buffer_count = 0;
+
+	float bounce_velocity_threshold = 0.0f;
+
+	std::atomic<float> max_penetration = 0.0f;
+
+	std::atomic<int32_t> contact_count = 0;
+
+	bool tracking_penetration = false;
+
 #ifdef GDJ_CONFIG_EDITOR
 	PackedVector3Array debug_contacts;
 
@@ -135,7 +135,7 @@ JoltDebugGeometry3D::~JoltDebugGeometry3D() = default;
 
 #endif // JPH_DEBUG_RENDERER
 
-void JoltDebugGeometry3D::_process([[maybe_unused]] double p_delta) {
+void JoltDebugGeometry3D::_physics_process([[maybe_unused]] double p_delta) {
 #ifdef JPH_DEBUG_RENDERER
 	auto* physics_server = dynamic_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton());
 
@@ -152,6 +152,9 @@ void JoltDebugGeometry3D::_process([[maybe_unused]] double p_delta) {
 	RenderingServer* rendering_server = RenderingServer::get_singleton();
 	ERR_FAIL_NULL(rendering_server);
 
+	// We draw during the physics tick, since that's the one point in the frame where a step running
+	// on a separate thread is guaranteed to have finished, which means we never have to wait for it
+	// here, at the cost of the geometry lagging one step behind when stepping on a separate thread.
 	const JoltSpace3D* space = physics_server->get_space(get_world_3d()->get_space());
 	ERR_FAIL_NULL(space);
 
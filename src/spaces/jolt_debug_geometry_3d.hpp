@@ -22,7 +22,7 @@ public:
 
 	~JoltDebugGeometry3D() override;
 
-	void _process(double p_delta) override;
+	void _physics_process(double p_delta) override;
 
 	bool get_draw_bodies() const;
 
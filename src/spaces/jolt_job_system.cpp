@@ -1,10 +1,42 @@
 #include "jolt_job_system.hpp"
 
 #include "servers/jolt_project_settings.hpp"
+#include "spaces/jolt_job_thread_pool.hpp"
+#include "spaces/jolt_profiler.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+int64_t nsec_since(Clock::time_point p_start) {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - p_start).count();
+}
+
+// Each space that's being stepped will be holding on to at most one barrier of its own, which means
+// we need to reserve one barrier per concurrent step on top of what Jolt itself expects to use.
+constexpr int32_t MAX_CONCURRENT_STEPS = 8;
+
+// How many queued jobs that don't belong to the barrier being waited on can be nested inside each
+// other on a single thread. A queued job might itself wait on a barrier, like when stepping spaces
+// in parallel, and we don't want a space to end up stuck behind an unbounded chain of other work.
+constexpr int32_t MAX_HELPING_DEPTH = 1;
+
+// How long we wait for the dedicated threads to release any remaining jobs after a step, before
+// giving up and leaving them until after the next step instead.
+constexpr int64_t RECLAIM_TIMEOUT_NSEC = 1000000000;
+
+#ifdef GDJ_CONFIG_EDITOR
+
+constexpr char WAIT_IDLE_TIMING_NAME[] = "WaitForJobs (Idle)";
+
+constexpr char WAIT_HELPING_TIMING_NAME[] = "WaitForJobs (Helping)";
+
+#endif // GDJ_CONFIG_EDITOR
+
+} // namespace
 
 JoltJobSystem::JoltJobSystem()
-	: JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers)
-	, jobs(JPH::cMaxPhysicsJobs) {
+	: barriers(JPH::cMaxPhysicsBarriers + MAX_CONCURRENT_STEPS) {
 	const int32_t max_threads = JoltProjectSettings::get_max_threads();
 
 	if (max_threads != -1) {
@@ -12,6 +44,60 @@ JoltJobSystem::JoltJobSystem()
 	} else {
 		thread_count = OS::get_singleton()->get_processor_count();
 	}
+
+	if (JoltProjectSettings::use_dedicated_job_threads()) {
+		thread_pool = new JoltJobThreadPool(MAX(thread_count, 1), &Job::execute);
+	}
+}
+
+JoltJobSystem::~JoltJobSystem() {
+	delete_safely(thread_pool);
+}
+
+int32_t JoltJobSystem::get_max_concurrent_steps() const {
+	return MAX(MIN(thread_count, MAX_CONCURRENT_STEPS), 1);
+}
+
+void JoltJobSystem::run_parallel(
+	const char* p_name,
+	int32_t p_count,
+	const std::function<void(int32_t)>& p_function
+) {
+	if (p_count <= 1) {
+		if (p_count == 1) {
+			p_function(0);
+		}
+
+		return;
+	}
+
+	JPH::JobSystem::Barrier* barrier = CreateBarrier();
+
+	if (barrier == nullptr) {
+		WARN_PRINT_ONCE(
+			"Godot Jolt's job system ran out of barriers. This should not happen. "
+			"Falling back to running jobs on the calling thread."
+		);
+
+		for (int32_t i = 0; i < p_count; ++i) {
+			p_function(i);
+		}
+
+		return;
+	}
+
+	for (int32_t i = 1; i < p_count; ++i) {
+		barrier->AddJob(CreateJob(p_name, JPH::Color::sGreen, [&p_function, i]() {
+			p_function(i);
+		}));
+	}
+
+	// The calling thread would otherwise just sit idle in `WaitForJobs`, so we might as well put it
+	// to work on the first item.
+	p_function(0);
+
+	WaitForJobs(barrier);
+	DestroyBarrier(barrier);
 }
 
 void JoltJobSystem::pre_step() {
@@ -57,11 +143,7 @@ JoltJobSystem::Job::Job(
 	JPH::uint32 p_dependency_count
 )
 	: JPH::JobSystem::Job(p_name, p_color, p_job_system, p_job_function, p_dependency_count)
-#ifdef GDJ_CONFIG_EDITOR
-	, name(p_name)
-#endif // GDJ_CONFIG_EDITOR
-{
-}
+	, name(p_name) { }
 
 JoltJobSystem::Job::~Job() {
 	if (task_id != -1) {
@@ -69,59 +151,216 @@ JoltJobSystem::Job::~Job() {
 	}
 }
 
-void JoltJobSystem::Job::push_completed(Job* p_job) {
-	Job* prev_head = nullptr;
-
-	do {
-		prev_head = completed_head;
-		p_job->completed_next = prev_head;
-	} while (!completed_head.compare_exchange_weak(prev_head, p_job));
-}
-
-JoltJobSystem::Job* JoltJobSystem::Job::pop_completed() {
-	Job* prev_head = nullptr;
-
-	do {
-		prev_head = completed_head;
-
-		if (prev_head == nullptr) {
-			return nullptr;
-		}
-	} while (!completed_head.compare_exchange_weak(prev_head, prev_head->completed_next));
-
-	return prev_head;
-}
-
-void JoltJobSystem::Job::queue() {
+void JoltJobSystem::Job::queue(JoltJobThreadPool* p_thread_pool) {
 	AddRef();
 
+	if (p_thread_pool != nullptr) {
+		p_thread_pool->enqueue(this);
+		return;
+	}
+
 	// HACK(mihe): Ideally we would use Jolt's actual job name here, but I'd rather not incur the
 	// overhead of a memory allocation or thread-safe lookup every time we create/queue a task. So
 	// instead we use the same cached description for all of them.
 	static const String task_name("JoltPhysics");
 
-	task_id = WorkerThreadPool::get_singleton()->add_native_task(&_execute, this, true, task_name);
+	task_id = WorkerThreadPool::get_singleton()->add_native_task(&execute, this, true, task_name);
 }
 
-void JoltJobSystem::Job::_execute(void* p_user_data) {
+void JoltJobSystem::Job::execute(void* p_user_data) {
 	auto* job = static_cast<Job*>(p_user_data);
 
+	job->run();
+	job->Release();
+}
+
+void JoltJobSystem::Job::run() {
+	// A thread waiting on a barrier might have gotten to this job before whoever it was queued on
+	if (!CanBeExecuted()) {
+		return;
+	}
+
+	JOLT_PROFILE_SCOPE(name);
+
 #ifdef GDJ_CONFIG_EDITOR
 	const uint64_t time_start = Time::get_singleton()->get_ticks_usec();
 #endif // GDJ_CONFIG_EDITOR
 
-	job->Execute();
+	Execute();
 
 #ifdef GDJ_CONFIG_EDITOR
 	const uint64_t time_end = Time::get_singleton()->get_ticks_usec();
 	const uint64_t time_elapsed = time_end - time_start;
 
 	timings_lock.lock();
-	timings_by_job[job->name] += time_elapsed;
+	timings_by_job[name] += time_elapsed;
 	timings_lock.unlock();
 #endif // GDJ_CONFIG_EDITOR
+}
 
-	job->Release();
+JoltJobSystem::Barrier::Barrier(JoltJobSystem* p_job_system)
+	: job_system(p_job_system) { }
+
+JoltJobSystem::Barrier::~Barrier() {
+	ERR_FAIL_COND_MSG(
+		read_index != write_index,
+		"Godot Jolt's job system destroyed a barrier that still had jobs in it. "
+		"This should not happen."
+	);
+}
+
+void JoltJobSystem::Barrier::AddJob(const JPH::JobHandle& p_job) {
+	JPH::JobSystem::Job* job = p_job.GetPtr();
+
+	// We increment this before the job knows about us, since it might finish and decrement it
+	// before we get a chance to otherwise.
+	unfinished_count++;
+
+	if (!job->SetBarrier(this)) {
+		// The job has already finished, so there's nothing to wait for
+		unfinished_count--;
+		return;
+	}
+
+	const uint32_t index = write_index.load(std::memory_order_relaxed);
+
+	ERR_FAIL_COND_MSG(
+		index - read_index >= MAX_JOBS,
+		"Godot Jolt's job system exceeded maximum number of jobs per barrier. "
+		"This should not happen."
+	);
+
+	job->AddRef();
+
+	jobs[index & (MAX_JOBS - 1)] = job;
+	write_index.store(index + 1, std::memory_order_release);
+
+	if (job->CanBeExecuted()) {
+		_signal();
+	}
+}
+
+void JoltJobSystem::Barrier::AddJobs(const JPH::JobHandle* p_jobs, JPH::uint p_job_count) {
+	for (JPH::uint i = 0; i < p_job_count; ++i) {
+		AddJob(p_jobs[i]);
+	}
+}
+
+void JoltJobSystem::Barrier::wait() {
+	JOLT_PROFILE_SCOPE("JoltJobSystem::WaitForJobs");
+
+	int64_t idle_nsec = 0;
+	int64_t helping_nsec = 0;
+
+	while (unfinished_count > 0) {
+		_release_finished_jobs();
+
+		const Clock::time_point start = Clock::now();
+
+		if (_try_execute_own_job() || _try_execute_queued_job()) {
+			helping_nsec += nsec_since(start);
+			continue;
+		}
+
+		_wait_for_signal();
+
+		idle_nsec += nsec_since(start);
+	}
+
+	// Any thread that just finished our last job might still be holding on to the lock, so we wait
+	// for it to let go before returning, at which point the barrier might get destroyed.
+	{ const MutexLock signal_lock(signal_mutex); }
+
+	_release_finished_jobs();
+
+	job_system->wait_idle_nsec.fetch_add(idle_nsec, std::memory_order_relaxed);
+	job_system->wait_helping_nsec.fetch_add(helping_nsec, std::memory_order_relaxed);
+
+#ifdef GDJ_CONFIG_EDITOR
+	timings_lock.lock();
+	timings_by_job[WAIT_IDLE_TIMING_NAME] += (uint64_t)(idle_nsec / 1000);
+	timings_by_job[WAIT_HELPING_TIMING_NAME] += (uint64_t)(helping_nsec / 1000);
+	timings_lock.unlock();
+#endif // GDJ_CONFIG_EDITOR
+}
+
+void JoltJobSystem::Barrier::OnJobFinished([[maybe_unused]] JPH::JobSystem::Job* p_job) {
+	const MutexLock signal_lock(signal_mutex);
+	unfinished_count--;
+	signal_count++;
+	signal_condition.notify_one();
+}
+
+void JoltJobSystem::Barrier::_release_finished_jobs() {
+	const uint32_t end_index = write_index.load(std::memory_order_acquire);
+
+	while (read_index != end_index) {
+		std::atomic<JPH::JobSystem::Job*>& slot = jobs[read_index & (MAX_JOBS - 1)];
+
+		JPH::JobSystem::Job* job = slot.load(std::memory_order_relaxed);
+
+		if (!job->IsDone()) {
+			break;
+		}
+
+		job->Release();
+		slot.store(nullptr, std::memory_order_relaxed);
+
+		++read_index;
+	}
+}
+
+bool JoltJobSystem::Barrier::_try_execute_own_job() {
+	const uint32_t end_index = write_index.load(std::memory_order_acquire);
+
+	for (uint32_t index = read_index; index != end_index; ++index) {
+		JPH::JobSystem::Job* job = jobs[index & (MAX_JOBS - 1)].load(std::memory_order_relaxed);
+
+		// The job will most likely also have been queued on some other thread, but `Execute` makes
+		// sure that only one of us will actually end up running it.
+		if (job->CanBeExecuted()) {
+			static_cast<Job*>(job)->run();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool JoltJobSystem::Barrier::_try_execute_queued_job() {
+	JoltJobThreadPool* thread_pool = job_system->thread_pool;
+
+	// HACK(mihe): There's no way to run a single pending task from `WorkerThreadPool`, so we can
+	// only help with other jobs when using our own threads.
+	if (thread_pool == nullptr || helping_depth >= MAX_HELPING_DEPTH) {
+		return false;
+	}
+
+	helping_depth++;
+
+	const bool executed = thread_pool->try_execute_one();
+
+	helping_depth--;
+
+	return executed;
+}
+
+void JoltJobSystem::Barrier::_signal() {
+	// We notify while holding the lock, since the barrier could otherwise be destroyed by the
+	// waiting thread in between us releasing the lock and notifying it.
+	const MutexLock signal_lock(signal_mutex);
+	signal_count++;
+	signal_condition.notify_one();
+}
+
+void JoltJobSystem::Barrier::_wait_for_signal() {
+	MutexLock signal_lock(signal_mutex);
+
+	signal_condition.wait(signal_lock, [this]() {
+		return signal_count > 0 || unfinished_count == 0;
+	});
+
+	signal_count = 0;
 }
 
 int JoltJobSystem::GetMaxConcurrency() const {
@@ -134,24 +373,17 @@ JPH::JobHandle JoltJobSystem::CreateJob(
 	const JPH::JobSystem::JobFunction& p_job_function,
 	JPH::uint32 p_dependency_count
 ) {
-	Job* job = nullptr;
+	Job* job = jobs.construct(p_name, p_color, this, p_job_function, p_dependency_count);
 
-	while (true) {
-		job = jobs.construct(p_name, p_color, this, p_job_function, p_dependency_count);
+	// Jolt has no way of dealing with a job failing to be created, and will dereference whatever
+	// we return here, so there's no point in trying to recover from this.
+	CRASH_COND_MSG(
+		job == nullptr,
+		"Godot Jolt's job system ran out of storage for jobs. This should not happen."
+	);
 
-		if (job != nullptr) {
-			break;
-		}
-
-		WARN_PRINT_ONCE(
-			"Godot Jolt's job system exceeded maximum number of jobs. This should not happen. "
-			"Waiting for jobs to become available."
-		);
-
-		OS::get_singleton()->delay_usec(100);
-
-		_reclaim_jobs();
-	}
+	live_job_count.fetch_add(1, std::memory_order_relaxed);
+	step_job_count.fetch_add(1, std::memory_order_relaxed);
 
 	// This will increment the job's reference count, so must happen before we queue the job
 	JPH::JobHandle job_handle(job);
@@ -164,7 +396,12 @@ JPH::JobHandle JoltJobSystem::CreateJob(
 }
 
 void JoltJobSystem::QueueJob(JPH::JobSystem::Job* p_job) {
-	static_cast<Job*>(p_job)->queue();
+	const Clock::time_point start = Clock::now();
+
+	static_cast<Job*>(p_job)->queue(thread_pool);
+
+	queued_job_count.fetch_add(1, std::memory_order_relaxed);
+	queue_time_nsec.fetch_add(nsec_since(start), std::memory_order_relaxed);
 }
 
 void JoltJobSystem::QueueJobs(JPH::JobSystem::Job** p_jobs, JPH::uint p_job_count) {
@@ -174,11 +411,51 @@ void JoltJobSystem::QueueJobs(JPH::JobSystem::Job** p_jobs, JPH::uint p_job_coun
 }
 
 void JoltJobSystem::FreeJob(JPH::JobSystem::Job* p_job) {
-	Job::push_completed(static_cast<Job*>(p_job));
+	// The job will be destructed along with all the others once the step is done, since it's not
+	// safe to destruct it here when it might still be inside its own `WorkerThreadPool` task.
+	live_job_count.fetch_sub(1, std::memory_order_release);
+}
+
+JPH::JobSystem::Barrier* JoltJobSystem::CreateBarrier() {
+	return barriers.construct(this);
+}
+
+void JoltJobSystem::DestroyBarrier(JPH::JobSystem::Barrier* p_barrier) {
+	barriers.destruct(static_cast<Barrier*>(p_barrier));
+}
+
+void JoltJobSystem::WaitForJobs(JPH::JobSystem::Barrier* p_barrier) {
+	static_cast<Barrier*>(p_barrier)->wait();
 }
 
 void JoltJobSystem::_reclaim_jobs() {
-	while (Job* job = Job::pop_completed()) {
-		jobs.destruct(job);
+	const int32_t job_count = step_job_count.exchange(0, std::memory_order_relaxed);
+
+	last_step_job_count = job_count;
+	peak_step_job_count = MAX(peak_step_job_count, job_count);
+
+	// Jobs that were executed by a waiting thread might still be sitting in a queue somewhere,
+	// holding on to a reference, so we let those queues drain before destructing anything. When
+	// using `WorkerThreadPool` each job instead waits for its own task as part of being destructed.
+	if (thread_pool != nullptr) {
+		const Clock::time_point start = Clock::now();
+
+		while (live_job_count.load(std::memory_order_acquire) != 0) {
+			ERR_FAIL_COND_MSG(
+				nsec_since(start) > RECLAIM_TIMEOUT_NSEC,
+				"Godot Jolt's job system timed out waiting for jobs to be released. "
+				"This should not happen."
+			);
+
+			std::this_thread::yield();
+		}
 	}
+
+	jobs.destruct_all();
+
+	ERR_FAIL_COND_MSG(
+		live_job_count.load(std::memory_order_acquire) != 0,
+		"Godot Jolt's job system destructed jobs that were still referenced. "
+		"This should not happen."
+	);
 }
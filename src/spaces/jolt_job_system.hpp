@@ -1,9 +1,39 @@
 #pragma once
 
-class JoltJobSystem final : public JPH::JobSystemWithBarrier {
+class JoltJobThreadPool;
+
+class JoltJobSystem final : public JPH::JobSystem {
 public:
 	JoltJobSystem();
 
+	~JoltJobSystem() override;
+
+	int32_t get_thread_count() const { return thread_count; }
+
+	bool uses_dedicated_threads() const { return thread_pool != nullptr; }
+
+	int64_t get_queued_job_count() const { return queued_job_count; }
+
+	int64_t get_queue_time_nsec() const { return queue_time_nsec; }
+
+	int64_t get_wait_idle_nsec() const { return wait_idle_nsec; }
+
+	int64_t get_wait_helping_nsec() const { return wait_helping_nsec; }
+
+	int32_t get_last_step_job_count() const { return last_step_job_count; }
+
+	int32_t get_peak_step_job_count() const { return peak_step_job_count; }
+
+	int32_t get_job_capacity() const { return (int32_t)jobs.get_capacity(); }
+
+	int32_t get_max_concurrent_steps() const;
+
+	void run_parallel(
+		const char* p_name,
+		int32_t p_count,
+		const std::function<void(int32_t)>& p_function
+	);
+
 	void pre_step();
 
 	void post_step();
@@ -27,28 +57,81 @@ private:
 
 		~Job();
 
-		static void push_completed(Job* p_job);
+		static void execute(void* p_user_data);
 
-		static Job* pop_completed();
+		void queue(JoltJobThreadPool* p_thread_pool);
 
-		void queue();
+		void run();
 
 		Job& operator=(const Job& p_other) = delete;
 
 		Job& operator=(Job&& p_other) = delete;
 
 	private:
-		static void _execute(void* p_user_data);
-
-		inline static std::atomic<Job*> completed_head = nullptr;
-
-#ifdef GDJ_CONFIG_EDITOR
 		const char* name = nullptr;
-#endif // GDJ_CONFIG_EDITOR
 
 		int64_t task_id = -1;
+	};
+
+	// Barrier that has the waiting thread execute jobs while it waits, rather than idling. Any jobs
+	// belonging to the barrier itself take priority, after which it will help with whatever else is
+	// queued on the dedicated threads, if any, up to a limited depth.
+	class Barrier final : public JPH::JobSystem::Barrier {
+		using Mutex = std::mutex;
+
+		using MutexLock = std::unique_lock<Mutex>;
+
+		static constexpr int32_t MAX_JOBS = 2048;
+
+	public:
+		explicit Barrier(JoltJobSystem* p_job_system);
+
+		Barrier(const Barrier& p_other) = delete;
+
+		Barrier(Barrier&& p_other) = delete;
+
+		~Barrier() override;
+
+		void AddJob(const JPH::JobHandle& p_job) override;
+
+		void AddJobs(const JPH::JobHandle* p_jobs, JPH::uint p_job_count) override;
+
+		void wait();
 
-		std::atomic<Job*> completed_next = nullptr;
+		Barrier& operator=(const Barrier& p_other) = delete;
+
+		Barrier& operator=(Barrier&& p_other) = delete;
+
+	private:
+		void OnJobFinished(JPH::JobSystem::Job* p_job) override;
+
+		void _release_finished_jobs();
+
+		bool _try_execute_own_job();
+
+		bool _try_execute_queued_job();
+
+		void _signal();
+
+		void _wait_for_signal();
+
+		inline static thread_local int32_t helping_depth = 0;
+
+		std::atomic<JPH::JobSystem::Job*> jobs[MAX_JOBS] = {};
+
+		JoltJobSystem* job_system = nullptr;
+
+		Mutex signal_mutex;
+
+		std::condition_variable signal_condition;
+
+		std::atomic<int32_t> unfinished_count = 0;
+
+		int32_t signal_count = 0;
+
+		uint32_t read_index = 0;
+
+		std::atomic<uint32_t> write_index = 0;
 	};
 
 	int GetMaxConcurrency() const override;
@@ -66,6 +149,12 @@ private:
 
 	void FreeJob(JPH::JobSystem::Job* p_job) override;
 
+	JPH::JobSystem::Barrier* CreateBarrier() override;
+
+	void DestroyBarrier(JPH::JobSystem::Barrier* p_barrier) override;
+
+	void WaitForJobs(JPH::JobSystem::Barrier* p_barrier) override;
+
 	void _reclaim_jobs();
 
 #ifdef GDJ_CONFIG_EDITOR
@@ -76,7 +165,27 @@ private:
 	inline static SpinLock timings_lock;
 #endif // GDJ_CONFIG_EDITOR
 
-	FreeList<Job> jobs;
+	GrowableArena<Job> jobs;
+
+	FreeList<Barrier> barriers;
+
+	JoltJobThreadPool* thread_pool = nullptr;
+
+	std::atomic<int64_t> queued_job_count = 0;
+
+	std::atomic<int64_t> queue_time_nsec = 0;
+
+	std::atomic<int64_t> wait_idle_nsec = 0;
+
+	std::atomic<int64_t> wait_helping_nsec = 0;
+
+	std::atomic<int32_t> live_job_count = 0;
+
+	std::atomic<int32_t> step_job_count = 0;
+
+	int32_t last_step_job_count = 0;
+
+	int32_t peak_step_job_count = 0;
 
 	int32_t thread_count = 0;
 };
@@ -0,0 +1,168 @@
+#include "jolt_job_thread_pool.hpp"
+
+namespace {
+
+// How many times an idle worker will look for work before going to sleep, since waking up a
+// sleeping thread is much more expensive than the occasional yield.
+constexpr int32_t MAX_IDLE_SPINS = 64;
+
+} // namespace
+
+JoltJobThreadPool::JoltJobThreadPool(int32_t p_thread_count, Executor p_executor)
+	: executor(p_executor) {
+	workers.resize(p_thread_count);
+
+	// All the workers need to exist before any of the threads start, since they'll be stealing from
+	// each other right away.
+	for (Worker*& worker : workers) {
+		worker = new Worker();
+	}
+
+	for (int32_t i = 0; i < p_thread_count; ++i) {
+		workers[i]->thread = std::thread(&JoltJobThreadPool::_worker_main, this, i);
+	}
+}
+
+JoltJobThreadPool::~JoltJobThreadPool() {
+	{
+		const MutexLock sleep_lock(sleep_mutex);
+		quitting = true;
+	}
+
+	sleep_condition.notify_all();
+
+	for (Worker*& worker : workers) {
+		worker->thread.join();
+		delete_safely(worker);
+	}
+}
+
+void JoltJobThreadPool::enqueue(void* p_item) {
+	// We increment this before the item is actually made available, so that it never undercounts,
+	// which would otherwise risk a worker going to sleep with work still left to do.
+	queued_count++;
+
+	const bool is_own_worker = current_pool == this && current_worker != -1;
+
+	if (!is_own_worker || !workers[current_worker]->deque.push(p_item)) {
+		const MutexLock injected_lock(injected_mutex);
+		injected.push_back(p_item);
+		injected_count++;
+	}
+
+	if (sleeping_count > 0) {
+		// Taking the lock here makes sure we can't slip in between a worker checking for work and
+		// it actually going to sleep, which would make us miss it.
+		{ const MutexLock sleep_lock(sleep_mutex); }
+
+		sleep_condition.notify_one();
+	}
+}
+
+bool JoltJobThreadPool::try_execute_one() {
+	const int32_t worker_index = current_pool == this ? current_worker : -1;
+
+	void* item = nullptr;
+
+	if (!_try_dequeue(worker_index, item)) {
+		return false;
+	}
+
+	queued_count--;
+	executor(item);
+
+	return true;
+}
+
+void JoltJobThreadPool::_worker_main(int32_t p_index) {
+	current_worker = p_index;
+	current_pool = this;
+
+	int32_t idle_spins = 0;
+
+	while (!quitting) {
+		void* item = nullptr;
+
+		if (_try_dequeue(p_index, item)) {
+			queued_count--;
+			executor(item);
+			idle_spins = 0;
+			continue;
+		}
+
+		if (++idle_spins < MAX_IDLE_SPINS) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		idle_spins = 0;
+
+		_wait_for_work();
+	}
+
+	current_worker = -1;
+	current_pool = nullptr;
+}
+
+bool JoltJobThreadPool::_try_dequeue(int32_t p_index, void*& p_item) {
+	if (p_index != -1 && workers[p_index]->deque.pop(p_item)) {
+		return true;
+	}
+
+	if (_try_dequeue_injected(p_item)) {
+		return true;
+	}
+
+	return _try_steal(p_index, p_item);
+}
+
+bool JoltJobThreadPool::_try_dequeue_injected(void*& p_item) {
+	if (injected_count.load(std::memory_order_relaxed) == 0) {
+		return false;
+	}
+
+	const MutexLock injected_lock(injected_mutex);
+
+	if (injected.is_empty()) {
+		return false;
+	}
+
+	const int32_t last_index = (int32_t)injected.size() - 1;
+
+	p_item = injected[last_index];
+
+	injected.resize(last_index);
+	injected_count--;
+
+	return true;
+}
+
+bool JoltJobThreadPool::_try_steal(int32_t p_index, void*& p_item) {
+	const auto worker_count = (int32_t)workers.size();
+
+	for (int32_t i = 0; i < worker_count; ++i) {
+		const int32_t victim_index = (p_index + 1 + i) % worker_count;
+
+		if (victim_index == p_index) {
+			continue;
+		}
+
+		if (workers[victim_index]->deque.steal(p_item)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void JoltJobThreadPool::_wait_for_work() {
+	MutexLock sleep_lock(sleep_mutex);
+
+	sleeping_count++;
+
+	sleep_condition.wait(sleep_lock, [this]() {
+		return queued_count > 0 || quitting;
+	});
+
+	sleeping_count--;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+class JoltJobThreadPool final {
+	using Mutex = std::mutex;
+
+	using MutexLock = std::unique_lock<Mutex>;
+
+	using Executor = void (*)(void* p_item);
+
+	using Deque = WorkStealingDeque<void*, 1024>;
+
+	struct alignas(64) Worker {
+		Deque deque;
+
+		std::thread thread;
+	};
+
+public:
+	JoltJobThreadPool(int32_t p_thread_count, Executor p_executor);
+
+	JoltJobThreadPool(const JoltJobThreadPool& p_other) = delete;
+
+	JoltJobThreadPool(JoltJobThreadPool&& p_other) = delete;
+
+	~JoltJobThreadPool();
+
+	int32_t get_thread_count() const { return (int32_t)workers.size(); }
+
+	void enqueue(void* p_item);
+
+	bool try_execute_one();
+
+	JoltJobThreadPool& operator=(const JoltJobThreadPool& p_other) = delete;
+
+	JoltJobThreadPool& operator=(JoltJobThreadPool&& p_other) = delete;
+
+private:
+	void _worker_main(int32_t p_index);
+
+	bool _try_dequeue(int32_t p_index, void*& p_item);
+
+	bool _try_dequeue_injected(void*& p_item);
+
+	bool _try_steal(int32_t p_index, void*& p_item);
+
+	void _wait_for_work();
+
+	inline static thread_local int32_t current_worker = -1;
+
+	inline static thread_local const JoltJobThreadPool* current_pool = nullptr;
+
+	LocalVector<Worker*> workers;
+
+	LocalVector<void*> injected;
+
+	Mutex injected_mutex;
+
+	Mutex sleep_mutex;
+
+	std::condition_variable sleep_condition;
+
+	std::atomic<int32_t> injected_count = 0;
+
+	std::atomic<int32_t> queued_count = 0;
+
+	std::atomic<int32_t> sleeping_count = 0;
+
+	std::atomic<bool> quitting = false;
+
+	Executor executor = nullptr;
+};
@@ -8,10 +8,20 @@
 #include "shapes/jolt_custom_motion_shape.hpp"
 #include "shapes/jolt_shape_impl_3d.hpp"
 #include "spaces/jolt_motion_filter_3d.hpp"
+#include "spaces/jolt_profiler.hpp"
 #include "spaces/jolt_query_collectors.hpp"
 #include "spaces/jolt_query_filter_3d.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
+namespace {
+
+// Queries can't run while the space is being stepped on a separate thread
+void wait_for_step() {
+	static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton())->wait_for_step();
+}
+
+} // namespace
+
 JoltPhysicsDirectSpaceState3D::JoltPhysicsDirectSpaceState3D(JoltSpace3D* p_space)
 	: space(p_space) { }
 
@@ -26,6 +36,8 @@ bool JoltPhysicsDirectSpaceState3D::_intersect_ray(
 	bool p_pick_ray,
 	PhysicsServer3DExtensionRayResult* p_result
 ) {
+	wait_for_step();
+
 	const JoltQueryFilter3D query_filter(
 		*this,
 		p_collision_mask,
@@ -100,6 +112,8 @@ int32_t JoltPhysicsDirectSpaceState3D::_intersect_point(
 	PhysicsServer3DExtensionShapeResult* p_results,
 	int32_t p_max_results
 ) {
+	wait_for_step();
+
 	if (p_max_results == 0) {
 		return 0;
 	}
@@ -149,6 +163,8 @@ int32_t JoltPhysicsDirectSpaceState3D::_intersect_shape(
 	PhysicsServer3DExtensionShapeResult* p_results,
 	int32_t p_max_results
 ) {
+	wait_for_step();
+
 	if (p_max_results == 0) {
 		return 0;
 	}
@@ -239,6 +255,8 @@ bool JoltPhysicsDirectSpaceState3D::_cast_motion(
 	real_t* p_closest_unsafe,
 	PhysicsServer3DExtensionShapeRestInfo* p_info
 ) {
+	wait_for_step();
+
 	// HACK(mihe): This rest info parameter doesn't seem to be used anywhere within Godot, and isn't
 	// exposed in the bindings, so this will be unsupported until anyone actually needs it.
 	ERR_FAIL_COND_D_MSG(
@@ -308,6 +326,8 @@ bool JoltPhysicsDirectSpaceState3D::_collide_shape(
 	int32_t p_max_results,
 	int32_t* p_result_count
 ) {
+	wait_for_step();
+
 	*p_result_count = 0;
 
 	if (p_max_results == 0) {
@@ -417,6 +437,8 @@ bool JoltPhysicsDirectSpaceState3D::_rest_info(
 	bool p_collide_with_areas,
 	PhysicsServer3DExtensionShapeRestInfo* p_info
 ) {
+	wait_for_step();
+
 #ifdef DEBUG_ENABLED
 	ERR_FAIL_COND_D_MSG(
 		p_transform.basis.determinant() == 0.0f,
@@ -499,6 +521,8 @@ Vector3 JoltPhysicsDirectSpaceState3D::_get_closest_point_to_object_volume(
 ) const {
 	auto* physics_server = static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton());
 
+	physics_server->wait_for_step();
+
 	JoltObjectImpl3D* object = physics_server->get_area(p_object);
 
 	if (object == nullptr) {
@@ -598,6 +622,8 @@ bool JoltPhysicsDirectSpaceState3D::test_body_motion(
 	bool p_recovery_as_collision,
 	PhysicsServer3DExtensionMotionResult* p_result
 ) const {
+	JOLT_PROFILE_SCOPE("JoltPhysicsDirectSpaceState3D::test_body_motion");
+
 	p_margin = MAX(p_margin, 0.0001f);
 	p_max_collisions = MIN(p_max_collisions, 32);
 
@@ -0,0 +1,218 @@
+#include "jolt_profiler.hpp"
+
+#include "servers/jolt_project_settings.hpp"
+
+namespace {
+
+std::mutex thread_buffers_mutex;
+
+} // namespace
+
+JoltProfiler::ThreadBuffer::ThreadBuffer(int32_t p_thread_index, int32_t p_capacity)
+	: thread_index(p_thread_index) {
+	events.resize(MAX(p_capacity, 1));
+}
+
+void JoltProfiler::set_enabled(bool p_enabled) {
+	enabled.store(p_enabled, std::memory_order_relaxed);
+}
+
+void JoltProfiler::begin_frame() {
+	if (!is_enabled()) {
+		return;
+	}
+
+	current_frame.fetch_add(1, std::memory_order_relaxed);
+
+	_record("Frame", EVENT_TYPE_FRAME);
+}
+
+void JoltProfiler::begin_event(const char* p_name) {
+	_record(p_name, EVENT_TYPE_BEGIN);
+}
+
+void JoltProfiler::end_event(const char* p_name) {
+	_record(p_name, EVENT_TYPE_END);
+}
+
+String JoltProfiler::dump_chrome_trace(int32_t p_frame_count) {
+	ERR_FAIL_COND_D(p_frame_count <= 0);
+
+	const uint32_t last_frame = current_frame.load(std::memory_order_relaxed);
+	const uint32_t first_frame = last_frame - MIN(last_frame, (uint32_t)p_frame_count - 1);
+
+	struct ThreadEvents {
+		LocalVector<Event> events;
+
+		int32_t thread_index = 0;
+	};
+
+	LocalVector<ThreadEvents> events_by_thread;
+
+	uint64_t first_timestamp = UINT64_MAX;
+
+	{
+		const std::lock_guard thread_buffers_lock(thread_buffers_mutex);
+
+		for (ThreadBuffer* buffer : thread_buffers) {
+			ThreadEvents& thread_events = events_by_thread.emplace_back();
+			thread_events.thread_index = buffer->thread_index;
+
+			// The job threads keep recording regardless of whether we're stepping or not, so we
+			// need to hold on to the buffer while copying it, or we'd risk reading torn events.
+			buffer->lock.lock();
+
+			const auto capacity = (uint64_t)buffer->events.size();
+			const uint64_t end = buffer->write_count;
+			const uint64_t begin = end > capacity ? end - capacity : 0;
+
+			for (uint64_t i = begin; i < end; ++i) {
+				const Event& event = buffer->events[(int32_t)(i % capacity)];
+
+				if (event.frame < first_frame) {
+					continue;
+				}
+
+				thread_events.events.push_back(event);
+				first_timestamp = MIN(first_timestamp, event.timestamp_nsec);
+			}
+
+			buffer->lock.unlock();
+		}
+	}
+
+	PackedStringArray entries;
+
+	for (const ThreadEvents& thread_events : events_by_thread) {
+		entries.push_back(vformat(
+			R"({"name":"thread_name","ph":"M","pid":0,"tid":%d,"args":{"name":"Thread %d"}})",
+			thread_events.thread_index,
+			thread_events.thread_index
+		));
+
+		int32_t depth = 0;
+
+		for (const Event& event : thread_events.events) {
+			const double timestamp_usec = (double)(event.timestamp_nsec - first_timestamp) / 1000.0;
+
+			const char* phase = nullptr;
+
+			switch (event.type) {
+				case EVENT_TYPE_BEGIN: {
+					phase = R"("ph":"B")";
+					depth++;
+				} break;
+				case EVENT_TYPE_END: {
+					// The matching begin event might have been overwritten already
+					if (depth == 0) {
+						continue;
+					}
+
+					phase = R"("ph":"E")";
+					depth--;
+				} break;
+				case EVENT_TYPE_FRAME: {
+					phase = R"("ph":"i","s":"g")";
+				} break;
+			}
+
+			entries.push_back(vformat(
+				R"({"name":"%s",%s,"ts":%.3f,"pid":0,"tid":%d,"args":{"frame":%d}})",
+				event.name,
+				phase,
+				timestamp_usec,
+				thread_events.thread_index,
+				event.frame
+			));
+		}
+	}
+
+	return String(R"({"displayTimeUnit":"ms","traceEvents":[)") + String(",").join(entries) + "]}";
+}
+
+Error JoltProfiler::write_chrome_trace(const String& p_path, int32_t p_frame_count) {
+	const Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+
+	ERR_FAIL_NULL_V_MSG(
+		file,
+		FileAccess::get_open_error(),
+		vformat("Failed to open '%s' for writing when saving profiler trace.", p_path)
+	);
+
+	file->store_string(dump_chrome_trace(p_frame_count));
+
+	return OK;
+}
+
+void JoltProfiler::_record(const char* p_name, EventType p_type) {
+	ThreadBuffer& buffer = _get_thread_buffer();
+
+	const uint64_t timestamp_nsec = _get_timestamp_nsec();
+	const uint32_t frame = current_frame.load(std::memory_order_relaxed);
+
+	buffer.lock.lock();
+
+	const uint64_t index = buffer.write_count++;
+
+	Event& event = buffer.events[(int32_t)(index % (uint64_t)buffer.events.size())];
+	event.name = p_name;
+	event.timestamp_nsec = timestamp_nsec;
+	event.frame = frame;
+	event.type = p_type;
+
+	buffer.lock.unlock();
+}
+
+JoltProfiler::ThreadBuffer& JoltProfiler::_get_thread_buffer() {
+	if (thread_buffer == nullptr) {
+		const std::lock_guard thread_buffers_lock(thread_buffers_mutex);
+
+		const auto thread_index = (int32_t)thread_buffers.size();
+		const int32_t capacity = JoltProjectSettings::get_profiler_buffer_size();
+
+		thread_buffer = new ThreadBuffer(thread_index, capacity);
+		thread_buffers.push_back(thread_buffer);
+	}
+
+	return *thread_buffer;
+}
+
+uint64_t JoltProfiler::_get_timestamp_nsec() {
+	using Clock = std::chrono::steady_clock;
+
+	const Clock::duration time_since_epoch = Clock::now().time_since_epoch();
+
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(time_since_epoch).count();
+}
+
+#ifdef JPH_EXTERNAL_PROFILE
+
+// These get invoked for every one of Jolt's own profile zones, so we route them into the same place
+// as our own zones, which lets us see how the time is split between the two.
+
+JPH::ExternalProfileMeasurement::ExternalProfileMeasurement(
+	const char* p_name,
+	[[maybe_unused]] JPH::uint32 p_color
+) {
+	static_assert(sizeof(const char*) <= sizeof(mUserData));
+
+	const char* name = JoltProfiler::is_enabled() ? p_name : nullptr;
+
+	memcpy(mUserData, &name, sizeof(name));
+
+	if (name != nullptr) {
+		JoltProfiler::begin_event(name);
+	}
+}
+
+JPH::ExternalProfileMeasurement::~ExternalProfileMeasurement() {
+	const char* name = nullptr;
+
+	memcpy(&name, mUserData, sizeof(name));
+
+	if (name != nullptr) {
+		JoltProfiler::end_event(name);
+	}
+}
+
+#endif // JPH_EXTERNAL_PROFILE
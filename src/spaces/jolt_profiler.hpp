@@ -0,0 +1,101 @@
+#pragma once
+
+// Lightweight instrumentation meant to be usable in release builds, where every thread records
+// begin/end events into its own fixed-size ring buffer, overwriting the oldest events as it goes.
+// Recording is disabled by default, in which case each scope costs a single relaxed load.
+class JoltProfiler {
+	enum EventType : uint32_t {
+		EVENT_TYPE_BEGIN,
+		EVENT_TYPE_END,
+		EVENT_TYPE_FRAME
+	};
+
+	struct Event {
+		const char* name = nullptr;
+
+		uint64_t timestamp_nsec = 0;
+
+		uint32_t frame = 0;
+
+		EventType type = EVENT_TYPE_BEGIN;
+	};
+
+	struct ThreadBuffer {
+		explicit ThreadBuffer(int32_t p_thread_index, int32_t p_capacity);
+
+		LocalVector<Event> events;
+
+		// Only ever taken by the owning thread, except when dumping, so it's virtually uncontended
+		SpinLock lock;
+
+		uint64_t write_count = 0;
+
+		int32_t thread_index = 0;
+	};
+
+public:
+	static bool is_enabled() { return enabled.load(std::memory_order_relaxed); }
+
+	static void set_enabled(bool p_enabled);
+
+	static void begin_frame();
+
+	static void begin_event(const char* p_name);
+
+	static void end_event(const char* p_name);
+
+	// Returns the events of the last `p_frame_count` frames in the Chrome trace event format, which
+	// can be loaded into `chrome://tracing` or Perfetto. Events from any step that's still running
+	// might be cut off at the end.
+	static String dump_chrome_trace(int32_t p_frame_count);
+
+	static Error write_chrome_trace(const String& p_path, int32_t p_frame_count);
+
+private:
+	static void _record(const char* p_name, EventType p_type);
+
+	static ThreadBuffer& _get_thread_buffer();
+
+	static uint64_t _get_timestamp_nsec();
+
+	inline static thread_local ThreadBuffer* thread_buffer = nullptr;
+
+	// HACK(mihe): These are kept alive for the lifetime of the process, since the threads that own
+	// them can outlive the physics server, and there's no way for us to clear the thread-local
+	// pointer of some other thread.
+	inline static LocalVector<ThreadBuffer*> thread_buffers;
+
+	inline static std::atomic<bool> enabled = false;
+
+	inline static std::atomic<uint32_t> current_frame = 0;
+};
+
+class JoltProfileScope {
+public:
+	explicit JoltProfileScope(const char* p_name)
+		: name(JoltProfiler::is_enabled() ? p_name : nullptr) {
+		if (name != nullptr) {
+			JoltProfiler::begin_event(name);
+		}
+	}
+
+	JoltProfileScope(const JoltProfileScope& p_other) = delete;
+
+	JoltProfileScope(JoltProfileScope&& p_other) = delete;
+
+	~JoltProfileScope() {
+		if (name != nullptr) {
+			JoltProfiler::end_event(name);
+		}
+	}
+
+	JoltProfileScope& operator=(const JoltProfileScope& p_other) = delete;
+
+	JoltProfileScope& operator=(JoltProfileScope&& p_other) = delete;
+
+private:
+	const char* name = nullptr;
+};
+
+#define JOLT_PROFILE_SCOPE(m_name) \
+	const JoltProfileScope GDJ_UNIQUE_IDENTIFIER(profile_scope)(m_name)
@@ -7,26 +7,59 @@
 #include "shapes/jolt_custom_shape_type.hpp"
 #include "shapes/jolt_shape_impl_3d.hpp"
 #include "spaces/jolt_contact_listener_3d.hpp"
+#include "spaces/jolt_job_system.hpp"
 #include "spaces/jolt_layer_mapper.hpp"
 #include "spaces/jolt_physics_direct_space_state_3d.hpp"
+#include "spaces/jolt_profiler.hpp"
 #include "spaces/jolt_temp_allocator.hpp"
+#include "spaces/jolt_temp_allocator_pool.hpp"
 
 namespace {
 
-constexpr double DEFAULT_CONTACT_RECYCLE_RADIUS = 0.01;
-constexpr double DEFAULT_CONTACT_MAX_SEPARATION = 0.05;
-constexpr double DEFAULT_CONTACT_MAX_ALLOWED_PENETRATION = 0.01;
-constexpr double DEFAULT_CONTACT_DEFAULT_BIAS = 0.8;
-constexpr double DEFAULT_SLEEP_THRESHOLD_LINEAR = 0.1;
 constexpr double DEFAULT_SLEEP_THRESHOLD_ANGULAR = 8.0 * Math_PI / 180;
-constexpr double DEFAULT_SOLVER_ITERATIONS = 8;
+
+constexpr int32_t BODIES_PER_CHUNK = 256;
+
+constexpr int32_t MIN_STEPS_BETWEEN_OPTIMIZATIONS = 10;
+
+constexpr JPH::uint LOW_QUALITY_VELOCITY_ITERATIONS = 2;
+constexpr JPH::uint LOW_QUALITY_POSITION_ITERATIONS = 1;
+constexpr float LOW_QUALITY_SLEEP_TIME_THRESHOLD = 0.1f;
+constexpr float LOW_QUALITY_SLEEP_VELOCITY_MULTIPLIER = 4.0f;
+
+constexpr JPH::uint HIGH_QUALITY_VELOCITY_ITERATIONS = 16;
+constexpr JPH::uint HIGH_QUALITY_POSITION_ITERATIONS = 4;
+
+int64_t usec_since(uint64_t p_start_usec) {
+	return (int64_t)(Time::get_singleton()->get_ticks_usec() - p_start_usec);
+}
+
+JPH::PhysicsSettings make_default_physics_settings() {
+	JPH::PhysicsSettings settings;
+	settings.mBaumgarte = JoltProjectSettings::get_position_correction();
+	settings.mSpeculativeContactDistance = JoltProjectSettings::get_contact_distance();
+	settings.mPenetrationSlop = JoltProjectSettings::get_contact_penetration();
+	settings.mLinearCastThreshold = JoltProjectSettings::get_ccd_movement_threshold();
+	settings.mLinearCastMaxPenetration = JoltProjectSettings::get_ccd_max_penetration();
+	settings.mNumVelocitySteps = (JPH::uint)JoltProjectSettings::get_velocity_iterations();
+	settings.mNumPositionSteps = (JPH::uint)JoltProjectSettings::get_position_iterations();
+	settings.mMinVelocityForRestitution = JoltProjectSettings::get_bounce_velocity_threshold();
+	settings.mTimeBeforeSleep = JoltProjectSettings::get_sleep_time_threshold();
+	settings.mPointVelocitySleepThreshold = JoltProjectSettings::get_sleep_velocity_threshold();
+	settings.mAllowSleeping = JoltProjectSettings::is_sleep_enabled();
+
+	return settings;
+}
 
 } // namespace
 
-JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
+JoltSpace3D::JoltSpace3D(
+	JoltJobSystem* p_job_system,
+	JoltTempAllocatorPool* p_temp_allocator_pool
+)
 	: body_accessor(this)
 	, job_system(p_job_system)
-	, temp_allocator(new JoltTempAllocator())
+	, temp_allocator_pool(p_temp_allocator_pool)
 	, layer_mapper(new JoltLayerMapper())
 	, contact_listener(new JoltContactListener3D(this))
 	, physics_system(new JPH::PhysicsSystem()) {
@@ -40,20 +73,7 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 		*layer_mapper
 	);
 
-	JPH::PhysicsSettings settings;
-	settings.mBaumgarte = JoltProjectSettings::get_position_correction();
-	settings.mSpeculativeContactDistance = JoltProjectSettings::get_contact_distance();
-	settings.mPenetrationSlop = JoltProjectSettings::get_contact_penetration();
-	settings.mLinearCastThreshold = JoltProjectSettings::get_ccd_movement_threshold();
-	settings.mLinearCastMaxPenetration = JoltProjectSettings::get_ccd_max_penetration();
-	settings.mNumVelocitySteps = (JPH::uint)JoltProjectSettings::get_velocity_iterations();
-	settings.mNumPositionSteps = (JPH::uint)JoltProjectSettings::get_position_iterations();
-	settings.mMinVelocityForRestitution = JoltProjectSettings::get_bounce_velocity_threshold();
-	settings.mTimeBeforeSleep = JoltProjectSettings::get_sleep_time_threshold();
-	settings.mPointVelocitySleepThreshold = JoltProjectSettings::get_sleep_velocity_threshold();
-	settings.mAllowSleeping = JoltProjectSettings::is_sleep_enabled();
-
-	physics_system->SetPhysicsSettings(settings);
+	physics_system->SetPhysicsSettings(make_default_physics_settings());
 	physics_system->SetGravity(JPH::Vec3::sZero());
 	physics_system->SetContactListener(contact_listener);
 	physics_system->SetSoftBodyContactListener(contact_listener);
@@ -75,18 +95,6 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 			return CLAMP(p_body1.GetRestitution() + p_body2.GetRestitution(), 0.0f, 1.0f);
 		}
 	);
-
-#ifdef GDJ_CONFIG_EDITOR
-	// HACK(mihe): The `EditorLog` class gets initialized fairly late in the application flow, so if
-	// we do this any earlier the warning is only ever going to be emitted to stdout and not the
-	// editor log, hence why this is here.
-	if (JoltProjectSettings::should_run_on_separate_thread()) {
-		WARN_PRINT_ONCE(
-			"Running on a separate thread is not currently supported by Godot Jolt. "
-			"Any such setting will be ignored."
-		);
-	}
-#endif // GDJ_CONFIG_EDITOR
 }
 
 JoltSpace3D::~JoltSpace3D() {
@@ -94,20 +102,43 @@ JoltSpace3D::~JoltSpace3D() {
 	delete_safely(physics_system);
 	delete_safely(contact_listener);
 	delete_safely(layer_mapper);
-	delete_safely(temp_allocator);
 }
 
 void JoltSpace3D::step(float p_step) {
+	JOLT_PROFILE_SCOPE("JoltSpace3D::step");
+
 	last_step = p_step;
 
+	temp_allocator = temp_allocator_pool->acquire();
+
+	uint64_t phase_start = Time::get_singleton()->get_ticks_usec();
+
 	_pre_step(p_step);
 
-	const JPH::EPhysicsUpdateError
-		update_error = physics_system->Update(p_step, 1, temp_allocator, job_system);
+	pre_step_usec = usec_since(phase_start);
+
+	JPH::EPhysicsUpdateError update_error = JPH::EPhysicsUpdateError::None;
+
+	{
+		JOLT_PROFILE_SCOPE("PhysicsSystem::Update");
+
+		phase_start = Time::get_singleton()->get_ticks_usec();
+
+		update_error = physics_system->Update(
+			p_step,
+			pending_collision_steps,
+			temp_allocator,
+			job_system
+		);
+
+		update_usec = usec_since(phase_start);
+	}
 
 	if ((update_error & JPH::EPhysicsUpdateError::ManifoldCacheFull) !=
 		JPH::EPhysicsUpdateError::None)
 	{
+		manifold_cache_full_count++;
+
 		WARN_PRINT_ONCE(vformat(
 			"Jolt's manifold cache exceeded capacity and contacts were ignored. "
 			"Consider increasing maximum number of contact constraints in project settings. "
@@ -119,6 +150,8 @@ void JoltSpace3D::step(float p_step) {
 	if ((update_error & JPH::EPhysicsUpdateError::BodyPairCacheFull) !=
 		JPH::EPhysicsUpdateError::None)
 	{
+		body_pair_cache_full_count++;
+
 		WARN_PRINT_ONCE(vformat(
 			"Jolt's body pair cache exceeded capacity and contacts were ignored. "
 			"Consider increasing maximum number of body pairs in project settings. "
@@ -130,6 +163,8 @@ void JoltSpace3D::step(float p_step) {
 	if ((update_error & JPH::EPhysicsUpdateError::ContactConstraintsFull) !=
 		JPH::EPhysicsUpdateError::None)
 	{
+		contact_constraints_full_count++;
+
 		WARN_PRINT_ONCE(vformat(
 			"Jolt's contact constraint buffer exceeded capacity and contacts were ignored. "
 			"Consider increasing maximum number of contact constraints in project settings. "
@@ -138,12 +173,21 @@ void JoltSpace3D::step(float p_step) {
 		));
 	}
 
+	phase_start = Time::get_singleton()->get_ticks_usec();
+
 	_post_step(p_step);
 
+	post_step_usec = usec_since(phase_start);
+
+	temp_allocator_pool->release(temp_allocator);
+	temp_allocator = nullptr;
+
 	has_stepped = true;
 }
 
 void JoltSpace3D::call_queries() {
+	JOLT_PROFILE_SCOPE("JoltSpace3D::call_queries");
+
 	if (!has_stepped) {
 		// HACK(mihe): We need to skip the first invocation of this method, because there will be
 		// pending notifications that need to be flushed first, which can cause weird conflicts with
@@ -153,7 +197,11 @@ void JoltSpace3D::call_queries() {
 		return;
 	}
 
-	body_accessor.acquire_all();
+	const uint64_t start = Time::get_singleton()->get_ticks_usec();
+
+	// Only the bodies that were visited during the step can have had their state changed, so
+	// there's no need to visit anything else.
+	body_accessor.acquire(step_body_ids.ptr(), step_body_ids.size());
 
 	const int32_t body_count = body_accessor.get_count();
 
@@ -167,44 +215,57 @@ void JoltSpace3D::call_queries() {
 		}
 	}
 
-	for (int32_t i = 0; i < body_count; ++i) {
+	body_accessor.release();
+
+	// Areas can end up enqueuing themselves again as part of the callbacks we invoke, so we swap
+	// the queue out before iterating over it, to make sure it doesn't get modified from under us.
+	std::swap(queried_area_ids, querying_area_ids);
+	queried_area_ids.clear();
+
+	body_accessor.acquire(querying_area_ids.ptr(), querying_area_ids.size());
+
+	const int32_t area_count = body_accessor.get_count();
+
+	for (int32_t i = 0; i < area_count; ++i) {
 		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSensor()) {
-				auto* area = reinterpret_cast<JoltAreaImpl3D*>(jolt_body->GetUserData());
+			auto* area = reinterpret_cast<JoltAreaImpl3D*>(jolt_body->GetUserData());
 
-				area->call_queries(*jolt_body);
-			}
+			area->call_queries(*jolt_body);
 		}
 	}
 
 	body_accessor.release();
+
+	call_queries_usec = usec_since(start);
 }
 
 double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
+	const JPH::PhysicsSettings& settings = physics_system->GetPhysicsSettings();
+
 	switch (p_param) {
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS: {
-			return DEFAULT_CONTACT_RECYCLE_RADIUS;
+			return Math::sqrt(settings.mContactPointPreserveLambdaMaxDistSq);
 		}
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_SEPARATION: {
-			return DEFAULT_CONTACT_MAX_SEPARATION;
+			return settings.mSpeculativeContactDistance;
 		}
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_ALLOWED_PENETRATION: {
-			return DEFAULT_CONTACT_MAX_ALLOWED_PENETRATION;
+			return settings.mPenetrationSlop;
 		}
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_DEFAULT_BIAS: {
-			return DEFAULT_CONTACT_DEFAULT_BIAS;
+			return settings.mBaumgarte;
 		}
 		case PhysicsServer3D::SPACE_PARAM_BODY_LINEAR_VELOCITY_SLEEP_THRESHOLD: {
-			return DEFAULT_SLEEP_THRESHOLD_LINEAR;
+			return settings.mPointVelocitySleepThreshold;
 		}
 		case PhysicsServer3D::SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD: {
 			return DEFAULT_SLEEP_THRESHOLD_ANGULAR;
 		}
 		case PhysicsServer3D::SPACE_PARAM_BODY_TIME_TO_SLEEP: {
-			return JoltProjectSettings::get_sleep_time_threshold();
+			return settings.mTimeBeforeSleep;
 		}
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS: {
-			return DEFAULT_SOLVER_ITERATIONS;
+			return settings.mNumVelocitySteps;
 		}
 		default: {
 			ERR_FAIL_D_MSG(vformat("Unhandled space parameter: '%d'", p_param));
@@ -212,63 +273,201 @@ double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
 	}
 }
 
-void JoltSpace3D::set_param(
-	PhysicsServer3D::SpaceParameter p_param,
-	[[maybe_unused]] double p_value
-) {
+void JoltSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, double p_value) {
+	JPH::PhysicsSettings settings = physics_system->GetPhysicsSettings();
+
 	switch (p_param) {
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS: {
-			WARN_PRINT(
-				"Space-specific contact recycle radius is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mContactPointPreserveLambdaMaxDistSq = float(p_value * p_value);
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_SEPARATION: {
-			WARN_PRINT(
-				"Space-specific contact max separation is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mSpeculativeContactDistance = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_ALLOWED_PENETRATION: {
-			WARN_PRINT(
-				"Space-specific contact max allowed penetration is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mPenetrationSlop = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_DEFAULT_BIAS: {
-			WARN_PRINT(
-				"Space-specific contact default bias is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mBaumgarte = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_BODY_LINEAR_VELOCITY_SLEEP_THRESHOLD: {
-			WARN_PRINT(
-				"Space-specific linear velocity sleep threshold is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mPointVelocitySleepThreshold = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD: {
 			WARN_PRINT(
 				"Space-specific angular velocity sleep threshold is not supported by Godot Jolt. "
-				"Any such value will be ignored."
+				"Any such value will be ignored. "
+				"Jolt only considers the linear velocity of a body's points when deciding whether "
+				"it should sleep, which can be set using the linear velocity sleep threshold."
 			);
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_BODY_TIME_TO_SLEEP: {
-			WARN_PRINT(
-				"Space-specific body sleep time is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mTimeBeforeSleep = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS: {
-			WARN_PRINT(
-				"Space-specific solver iterations is not supported by Godot Jolt. "
-				"Any such value will be ignored."
+			ERR_FAIL_COND_MSG(
+				p_value < 1,
+				vformat(
+					"Invalid solver iterations for physics space with RID '%d'. "
+					"Solver iterations must be at least 1, but was set to %d.",
+					rid.get_id(),
+					(int32_t)p_value
+				)
+			);
+
+			settings.mNumVelocitySteps = (JPH::uint)p_value;
+		} break;
+		default: {
+			ERR_FAIL_MSG(vformat("Unhandled space parameter: '%d'", p_param));
+		} break;
+	}
+
+	physics_system->SetPhysicsSettings(settings);
+}
+
+double JoltSpace3D::get_jolt_param(JoltParameter p_param) const {
+	switch (p_param) {
+		case JoltPhysicsServer3D::SPACE_COLLISION_STEPS: {
+			return collision_steps;
+		}
+		case JoltPhysicsServer3D::SPACE_MAX_COLLISION_STEPS: {
+			return max_collision_steps;
+		}
+		case JoltPhysicsServer3D::SPACE_ADAPTIVE_VELOCITY_THRESHOLD: {
+			return adaptive_velocity_threshold;
+		}
+		case JoltPhysicsServer3D::SPACE_ADAPTIVE_PENETRATION_THRESHOLD: {
+			return adaptive_penetration_threshold;
+		}
+		case JoltPhysicsServer3D::SPACE_POSITION_ITERATIONS: {
+			return physics_system->GetPhysicsSettings().mNumPositionSteps;
+		}
+		default: {
+			ERR_FAIL_D_MSG(vformat("Unhandled space parameter: '%d'", p_param));
+		}
+	}
+}
+
+void JoltSpace3D::set_jolt_param(JoltParameter p_param, double p_value) {
+	switch (p_param) {
+		case JoltPhysicsServer3D::SPACE_COLLISION_STEPS: {
+			ERR_FAIL_COND_MSG(
+				p_value < 1,
+				vformat(
+					"Invalid collision step count for physics space with RID '%d'. "
+					"Collision step count must be at least 1, but was set to %d.",
+					rid.get_id(),
+					(int32_t)p_value
+				)
+			);
+
+			collision_steps = (int32_t)p_value;
+		} break;
+		case JoltPhysicsServer3D::SPACE_MAX_COLLISION_STEPS: {
+			ERR_FAIL_COND_MSG(
+				p_value < 1,
+				vformat(
+					"Invalid maximum collision step count for physics space with RID '%d'. "
+					"Maximum collision step count must be at least 1, but was set to %d.",
+					rid.get_id(),
+					(int32_t)p_value
+				)
+			);
+
+			max_collision_steps = (int32_t)p_value;
+		} break;
+		case JoltPhysicsServer3D::SPACE_ADAPTIVE_VELOCITY_THRESHOLD: {
+			adaptive_velocity_threshold = (float)p_value;
+		} break;
+		case JoltPhysicsServer3D::SPACE_ADAPTIVE_PENETRATION_THRESHOLD: {
+			adaptive_penetration_threshold = (float)p_value;
+		} break;
+		case JoltPhysicsServer3D::SPACE_POSITION_ITERATIONS: {
+			ERR_FAIL_COND_MSG(
+				p_value < 0,
+				vformat(
+					"Invalid position iterations for physics space with RID '%d'. "
+					"Position iterations must be at least 0, but was set to %d.",
+					rid.get_id(),
+					(int32_t)p_value
+				)
 			);
+
+			JPH::PhysicsSettings settings = physics_system->GetPhysicsSettings();
+			settings.mNumPositionSteps = (JPH::uint)p_value;
+			physics_system->SetPhysicsSettings(settings);
 		} break;
 		default: {
 			ERR_FAIL_MSG(vformat("Unhandled space parameter: '%d'", p_param));
 		} break;
 	}
+
+	_update_collision_steps();
+}
+
+bool JoltSpace3D::get_jolt_flag(JoltFlag p_flag) const {
+	switch (p_flag) {
+		case JoltPhysicsServer3D::SPACE_FLAG_ADAPTIVE_COLLISION_STEPS: {
+			return adaptive_collision_steps;
+		}
+		case JoltPhysicsServer3D::SPACE_FLAG_ALLOW_SLEEPING: {
+			return physics_system->GetPhysicsSettings().mAllowSleeping;
+		}
+		default: {
+			ERR_FAIL_D_MSG(vformat("Unhandled space flag: '%d'", p_flag));
+		}
+	}
+}
+
+void JoltSpace3D::set_jolt_flag(JoltFlag p_flag, bool p_enabled) {
+	switch (p_flag) {
+		case JoltPhysicsServer3D::SPACE_FLAG_ADAPTIVE_COLLISION_STEPS: {
+			adaptive_collision_steps = p_enabled;
+		} break;
+		case JoltPhysicsServer3D::SPACE_FLAG_ALLOW_SLEEPING: {
+			JPH::PhysicsSettings settings = physics_system->GetPhysicsSettings();
+			settings.mAllowSleeping = p_enabled;
+			physics_system->SetPhysicsSettings(settings);
+		} break;
+		default: {
+			ERR_FAIL_MSG(vformat("Unhandled space flag: '%d'", p_flag));
+		} break;
+	}
+
+	_update_collision_steps();
+}
+
+void JoltSpace3D::apply_quality_preset(QualityPreset p_preset) {
+	JPH::PhysicsSettings settings = make_default_physics_settings();
+
+	switch (p_preset) {
+		case JoltPhysicsServer3D::SPACE_QUALITY_PRESET_LOW: {
+			// Background spaces rarely need stable stacking, so we trade solver accuracy for time
+			// and let bodies fall asleep sooner and at higher speeds than they otherwise would.
+			settings.mNumVelocitySteps = LOW_QUALITY_VELOCITY_ITERATIONS;
+			settings.mNumPositionSteps = LOW_QUALITY_POSITION_ITERATIONS;
+			settings.mTimeBeforeSleep = LOW_QUALITY_SLEEP_TIME_THRESHOLD;
+			settings.mPointVelocitySleepThreshold *= LOW_QUALITY_SLEEP_VELOCITY_MULTIPLIER;
+			settings.mAllowSleeping = true;
+		} break;
+		case JoltPhysicsServer3D::SPACE_QUALITY_PRESET_DEFAULT: {
+		} break;
+		case JoltPhysicsServer3D::SPACE_QUALITY_PRESET_HIGH: {
+			settings.mNumVelocitySteps = MAX(
+				settings.mNumVelocitySteps,
+				HIGH_QUALITY_VELOCITY_ITERATIONS
+			);
+
+			settings.mNumPositionSteps = MAX(
+				settings.mNumPositionSteps,
+				HIGH_QUALITY_POSITION_ITERATIONS
+			);
+		} break;
+		default: {
+			ERR_FAIL_MSG(vformat("Unhandled space quality preset: '%d'", p_preset));
+		} break;
+	}
+
+	physics_system->SetPhysicsSettings(settings);
 }
 
 JPH::BodyInterface& JoltSpace3D::get_body_iface() {
@@ -340,6 +539,13 @@ JoltWritableBodies3D JoltSpace3D::write_bodies(const JPH::BodyID* p_body_ids, in
 }
 
 JoltPhysicsDirectSpaceState3D* JoltSpace3D::get_direct_state() {
+	// Any bodies that were added since the last step need to be in the broadphase for queries to
+	// see them, which matches the behavior of Godot Physics. We can't touch the broadphase while
+	// the space is being stepped on a separate thread though, so they'll have to wait until then.
+	if (!stepping) {
+		flush_pending_bodies();
+	}
+
 	if (direct_state == nullptr) {
 		direct_state = memnew(JoltPhysicsDirectSpaceState3D(this));
 	}
@@ -379,6 +585,158 @@ void JoltSpace3D::remove_joint(JoltJointImpl3D* p_joint) {
 	remove_joint(p_joint->get_jolt_ref());
 }
 
+void JoltSpace3D::add_body(const JPH::BodyID& p_body_id) {
+	// Inserting bodies into the broadphase one by one is slow and leaves the broadphase poorly
+	// balanced, so we defer this until the next step (or query) and insert them all at once.
+	pending_body_ids.push_back(p_body_id);
+}
+
+void JoltSpace3D::remove_body(const JPH::BodyID& p_body_id) {
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	// Bodies that are still pending have never been added, and will be skipped when flushed, since
+	// their ID will have become invalid by then.
+	if (body_iface.IsAdded(p_body_id)) {
+		body_iface.RemoveBody(p_body_id);
+		bodies_removed_since_optimization++;
+	}
+}
+
+void JoltSpace3D::begin_bulk_add() {
+	bulk_add_depth++;
+}
+
+void JoltSpace3D::end_bulk_add() {
+	ERR_FAIL_COND_MSG(
+		bulk_add_depth == 0,
+		vformat(
+			"Mismatched bulk add for physics space with RID '%d'. "
+			"Make sure every call to end a bulk add is preceded by a call to begin one.",
+			rid.get_id()
+		)
+	);
+
+	bulk_add_depth--;
+
+	flush_pending_bodies();
+
+	// The whole point of a bulk add is to take the hit all at once, so rather than wait for the
+	// scheduled optimization we optimize the broadphase right away.
+	if (bulk_add_depth == 0 && bodies_added_since_optimization > 0) {
+		optimize_broad_phase();
+	}
+}
+
+void JoltSpace3D::flush_pending_bodies() {
+	if (pending_body_ids.is_empty() || bulk_add_depth > 0) {
+		return;
+	}
+
+	const JPH::BodyLockInterface& lock_iface = get_lock_iface();
+
+	int32_t body_count = 0;
+
+	for (const JPH::BodyID& body_id : pending_body_ids) {
+		const JPH::Body* body = lock_iface.TryGetBody(body_id);
+
+		if (body != nullptr && !body->IsInBroadPhase()) {
+			pending_body_ids[body_count++] = body_id;
+		}
+	}
+
+	pending_body_ids.resize(body_count);
+
+	if (body_count > 0) {
+		JPH::BodyInterface& body_iface = get_body_iface();
+
+		const JPH::BodyInterface::AddState add_state = body_iface.AddBodiesPrepare(
+			pending_body_ids.ptr(),
+			body_count
+		);
+
+		// HACK(mihe): Since `BODY_STATE_TRANSFORM` will be set right after creation it's more or
+		// less impossible to have a body be sleeping when created, so we always activate them.
+		body_iface.AddBodiesFinalize(
+			pending_body_ids.ptr(),
+			body_count,
+			add_state,
+			JPH::EActivation::Activate
+		);
+
+		bodies_added_since_optimization += body_count;
+	}
+
+	pending_body_ids.clear();
+}
+
+Dictionary JoltSpace3D::get_broad_phase_stats() const {
+	Dictionary stats;
+	stats["bodies_added"] = bodies_added_since_optimization;
+	stats["bodies_removed"] = bodies_removed_since_optimization;
+	stats["optimization_count"] = optimization_count;
+	stats["last_optimization_usec"] = last_optimization_usec;
+	stats["total_optimization_usec"] = total_optimization_usec;
+
+	return stats;
+}
+
+bool JoltSpace3D::needs_broad_phase_optimization() const {
+	const int32_t threshold = JoltProjectSettings::get_broad_phase_optimization_threshold();
+
+	if (threshold <= 0) {
+		return false;
+	}
+
+	const int32_t body_changes = bodies_added_since_optimization +
+		bodies_removed_since_optimization;
+
+	if (body_changes < threshold) {
+		return false;
+	}
+
+	// Streaming in a level tends to add bodies over several consecutive frames, so we hold off for
+	// a few steps between optimizations, to avoid paying for a full rebuild on every one of them.
+	return steps_since_optimization >= MIN_STEPS_BETWEEN_OPTIMIZATIONS;
+}
+
+void JoltSpace3D::optimize_broad_phase() {
+	JOLT_PROFILE_SCOPE("JoltSpace3D::optimize_broad_phase");
+
+	const uint64_t start = Time::get_singleton()->get_ticks_usec();
+
+	physics_system->OptimizeBroadPhase();
+
+	last_optimization_usec = usec_since(start);
+	total_optimization_usec += last_optimization_usec;
+
+	optimization_count++;
+
+	bodies_added_since_optimization = 0;
+	bodies_removed_since_optimization = 0;
+	steps_since_optimization = 0;
+}
+
+Dictionary JoltSpace3D::get_stats() const {
+	Dictionary stats;
+	stats["body_count"] = get_body_count();
+	stats["max_bodies"] = JoltProjectSettings::get_max_bodies();
+	stats["active_body_count"] = get_active_body_count();
+	stats["contact_manifolds"] = get_contact_manifold_count();
+	stats["max_contact_constraints"] = JoltProjectSettings::get_max_contact_constraints();
+	stats["max_body_pairs"] = JoltProjectSettings::get_max_body_pairs();
+	stats["manifold_cache_full_count"] = manifold_cache_full_count;
+	stats["body_pair_cache_full_count"] = body_pair_cache_full_count;
+	stats["contact_constraints_full_count"] = contact_constraints_full_count;
+	stats["temp_memory_peak"] = temp_memory_peak;
+	stats["temp_memory_last_step_peak"] = last_temp_memory_peak;
+	stats["pre_step_usec"] = pre_step_usec;
+	stats["update_usec"] = update_usec;
+	stats["post_step_usec"] = post_step_usec;
+	stats["call_queries_usec"] = call_queries_usec;
+
+	return stats;
+}
+
 #ifdef GDJ_CONFIG_EDITOR
 
 void JoltSpace3D::dump_debug_snapshot(const String& p_dir) {
@@ -450,50 +808,222 @@ void JoltSpace3D::set_max_debug_contacts(int32_t p_count) {
 
 #endif // GDJ_CONFIG_EDITOR
 
+void JoltSpace3D::enqueue_dirty(const JoltObjectImpl3D& p_object) {
+	dirty_body_ids.push_back(p_object.get_jolt_id());
+}
+
+void JoltSpace3D::enqueue_call_queries(const JoltAreaImpl3D& p_area) {
+	queried_area_ids.push_back(p_area.get_jolt_id());
+}
+
+void JoltSpace3D::enqueue_shape_changed(const JoltShapedObjectImpl3D& p_object) {
+	contact_listener->shape_changed(p_object);
+}
+
 void JoltSpace3D::_pre_step(float p_step) {
-	body_accessor.acquire_all();
+	JOLT_PROFILE_SCOPE("JoltSpace3D::_pre_step");
 
 	contact_listener->pre_step();
 
+	flush_pending_bodies();
+
+	steps_since_optimization++;
+
+	_collect_step_bodies();
+
+	body_accessor.acquire(step_body_ids.ptr(), step_body_ids.size());
+
 	const int32_t body_count = body_accessor.get_count();
+	const int32_t chunk_count = _get_chunk_count(body_count);
 
-	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSoftBody()) {
-				continue;
-			}
+	if (listeners_by_chunk.size() < chunk_count) {
+		listeners_by_chunk.resize(chunk_count);
+	}
+
+	job_system->run_parallel("PreStep", chunk_count, [&](int32_t p_chunk) {
+		LocalVector<JoltShapedObjectImpl3D*>& listeners = listeners_by_chunk[p_chunk];
+		listeners.clear();
 
-			auto* object = reinterpret_cast<JoltShapedObjectImpl3D*>(jolt_body->GetUserData());
+		const int32_t chunk_begin = p_chunk * BODIES_PER_CHUNK;
+		const int32_t chunk_end = MIN(chunk_begin + BODIES_PER_CHUNK, body_count);
 
-			object->pre_step(p_step, *jolt_body);
+		for (int32_t i = chunk_begin; i < chunk_end; ++i) {
+			if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
+				if (jolt_body->IsSoftBody()) {
+					continue;
+				}
 
-			if (object->reports_contacts()) {
-				contact_listener->listen_for(object);
+				auto* object = reinterpret_cast<JoltShapedObjectImpl3D*>(jolt_body->GetUserData());
+
+				object->pre_step(p_step, *jolt_body);
+
+				if (object->reports_contacts()) {
+					listeners.push_back(object);
+				}
 			}
 		}
+	});
+
+	// The contact listener isn't safe to modify from multiple threads, so we defer this until after
+	// all the chunks are done, which also means the order stays the same as when run serially.
+	for (int32_t i = 0; i < chunk_count; ++i) {
+		for (JoltShapedObjectImpl3D* object : listeners_by_chunk[i]) {
+			contact_listener->listen_for(object);
+
+			// Objects that report contacts need to be visited on every step, regardless of whether
+			// they're active or not, since static objects can still end up with contacts.
+			object->mark_dirty();
+		}
 	}
 
 	body_accessor.release();
 }
 
 void JoltSpace3D::_post_step(float p_step) {
-	body_accessor.acquire_all();
+	JOLT_PROFILE_SCOPE("JoltSpace3D::_post_step");
+
+	body_accessor.acquire(step_body_ids.ptr(), step_body_ids.size());
 
 	contact_listener->post_step();
 
+	temp_allocator->post_step();
+
+	last_temp_memory_peak = (int64_t)temp_allocator->get_last_step_peak_usage();
+	temp_memory_peak = MAX(temp_memory_peak, last_temp_memory_peak);
+
 	const int32_t body_count = body_accessor.get_count();
+	const int32_t chunk_count = _get_chunk_count(body_count);
 
-	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSoftBody()) {
-				continue;
+	if (max_speed_by_chunk.size() < chunk_count) {
+		max_speed_by_chunk.resize(chunk_count);
+	}
+
+	job_system->run_parallel("PostStep", chunk_count, [&](int32_t p_chunk) {
+		const int32_t chunk_begin = p_chunk * BODIES_PER_CHUNK;
+		const int32_t chunk_end = MIN(chunk_begin + BODIES_PER_CHUNK, body_count);
+
+		float max_speed_sq = 0.0f;
+
+		for (int32_t i = chunk_begin; i < chunk_end; ++i) {
+			if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
+				if (jolt_body->IsSoftBody()) {
+					continue;
+				}
+
+				auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
+
+				object->post_step(p_step, *jolt_body);
+
+				if (jolt_body->IsDynamic()) {
+					const float speed_sq = jolt_body->GetLinearVelocity().LengthSq();
+					max_speed_sq = MAX(max_speed_sq, speed_sq);
+				}
 			}
+		}
+
+		max_speed_by_chunk[p_chunk] = Math::sqrt(max_speed_sq);
+	});
+
+	body_accessor.release();
+
+	max_step_speed = 0.0f;
+
+	for (int32_t i = 0; i < chunk_count; ++i) {
+		max_step_speed = MAX(max_step_speed, max_speed_by_chunk[i]);
+	}
+
+	max_step_penetration = contact_listener->get_max_penetration();
+
+	// We take a snapshot of these here, so that they can be read while the next step is running
+	last_body_count.store((int32_t)physics_system->GetNumBodies(), std::memory_order_relaxed);
 
-			auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
+	last_active_body_count.store(
+		(int32_t)(
+			physics_system->GetNumActiveBodies(JPH::EBodyType::RigidBody) +
+			physics_system->GetNumActiveBodies(JPH::EBodyType::SoftBody)
+		),
+		std::memory_order_relaxed
+	);
+
+	// This also counts manifolds involving sensors, since they take up room in the manifold cache
+	// just the same, even though they don't end up as actual contact constraints
+	last_contact_manifold_count.store(
+		contact_listener->get_contact_count(),
+		std::memory_order_relaxed
+	);
+
+	_update_collision_steps();
+}
+
+void JoltSpace3D::_collect_step_bodies() {
+	constexpr JPH::EBodyType body_type = JPH::EBodyType::RigidBody;
+
+	const JPH::BodyID* active_ids = physics_system->GetActiveBodiesUnsafe(body_type);
+	const auto active_count = (int32_t)physics_system->GetNumActiveBodies(body_type);
+
+	step_body_ids.resize(active_count);
+	std::copy_n(active_ids, active_count, step_body_ids.ptr());
+
+	body_accessor.acquire(dirty_body_ids.ptr(), dirty_body_ids.size());
 
-			object->post_step(p_step, *jolt_body);
+	const int32_t dirty_count = body_accessor.get_count();
+
+	for (int32_t i = 0; i < dirty_count; ++i) {
+		JPH::Body* jolt_body = body_accessor.try_get(i);
+
+		if (jolt_body == nullptr) {
+			continue;
+		}
+
+		auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
+
+		object->clear_dirty();
+
+		// Active bodies are already part of the list, so we skip those to avoid visiting them twice
+		if (!jolt_body->IsActive()) {
+			step_body_ids.push_back(jolt_body->GetID());
 		}
 	}
 
 	body_accessor.release();
+
+	dirty_body_ids.clear();
+}
+
+int32_t JoltSpace3D::_get_chunk_count(int32_t p_body_count) const {
+	return (p_body_count + BODIES_PER_CHUNK - 1) / BODIES_PER_CHUNK;
+}
+
+void JoltSpace3D::_update_collision_steps() {
+	pending_collision_steps = collision_steps;
+
+	if (!adaptive_collision_steps) {
+		return;
+	}
+
+	// We base the number of collision steps for the upcoming step on what we saw in the previous
+	// one, adding one collision step for every multiple of the thresholds that was exceeded, which
+	// means the extra cost is only paid while things are actually moving fast or sinking in.
+
+	int32_t steps = collision_steps;
+
+	if (adaptive_velocity_threshold > 0.0f) {
+		const auto velocity_steps = (int32_t)Math::ceil(
+			max_step_speed / adaptive_velocity_threshold
+		);
+
+		steps = MAX(steps, velocity_steps);
+	}
+
+	if (adaptive_penetration_threshold > 0.0f) {
+		const auto penetration_steps = (int32_t)Math::ceil(
+			max_step_penetration / adaptive_penetration_threshold
+		);
+
+		steps = MAX(steps, penetration_steps);
+	}
+
+	const int32_t upper_limit = MAX(max_collision_steps, collision_steps);
+
+	pending_collision_steps = CLAMP(steps, collision_steps, upper_limit);
 }
@@ -1,17 +1,28 @@
 #pragma once
 
+#include "servers/jolt_physics_server_3d.hpp"
 #include "spaces/jolt_body_accessor_3d.hpp"
 
 class JoltAreaImpl3D;
 class JoltContactListener3D;
+class JoltJobSystem;
 class JoltJointImpl3D;
 class JoltLayerMapper;
 class JoltObjectImpl3D;
 class JoltPhysicsDirectSpaceState3D;
+class JoltShapedObjectImpl3D;
+class JoltTempAllocator;
+class JoltTempAllocatorPool;
 
 class JoltSpace3D final {
+	using JoltParameter = JoltPhysicsServer3D::SpaceParamJolt;
+
+	using JoltFlag = JoltPhysicsServer3D::SpaceFlagJolt;
+
+	using QualityPreset = JoltPhysicsServer3D::SpaceQualityPresetJolt;
+
 public:
-	explicit JoltSpace3D(JPH::JobSystem* p_job_system);
+	JoltSpace3D(JoltJobSystem* p_job_system, JoltTempAllocatorPool* p_temp_allocator_pool);
 
 	~JoltSpace3D();
 
@@ -27,6 +38,18 @@ public:
 
 	void set_param(PhysicsServer3D::SpaceParameter p_param, double p_value);
 
+	double get_jolt_param(JoltParameter p_param) const;
+
+	void set_jolt_param(JoltParameter p_param, double p_value);
+
+	bool get_jolt_flag(JoltFlag p_flag) const;
+
+	void set_jolt_flag(JoltFlag p_flag, bool p_enabled);
+
+	void apply_quality_preset(QualityPreset p_preset);
+
+	bool uses_adaptive_collision_steps() const { return adaptive_collision_steps; }
+
 	JPH::PhysicsSystem& get_physics_system() const { return *physics_system; }
 
 	JPH::BodyInterface& get_body_iface();
@@ -72,6 +95,10 @@ public:
 
 	float get_last_step() const { return last_step; }
 
+	bool is_stepping() const { return stepping; }
+
+	void set_stepping(bool p_stepping) { stepping = p_stepping; }
+
 	void add_joint(JPH::Constraint* p_jolt_ref);
 
 	void add_joint(JoltJointImpl3D* p_joint);
@@ -80,6 +107,41 @@ public:
 
 	void remove_joint(JoltJointImpl3D* p_joint);
 
+	void add_body(const JPH::BodyID& p_body_id);
+
+	void remove_body(const JPH::BodyID& p_body_id);
+
+	void begin_bulk_add();
+
+	void end_bulk_add();
+
+	void flush_pending_bodies();
+
+	Dictionary get_broad_phase_stats() const;
+
+	bool needs_broad_phase_optimization() const;
+
+	// Must not be called while the space is being stepped or queried
+	void optimize_broad_phase();
+
+	int32_t get_body_count() const { return last_body_count.load(std::memory_order_relaxed); }
+
+	int32_t get_active_body_count() const {
+		return last_active_body_count.load(std::memory_order_relaxed);
+	}
+
+	int32_t get_contact_manifold_count() const {
+		return last_contact_manifold_count.load(std::memory_order_relaxed);
+	}
+
+	Dictionary get_stats() const;
+
+	void enqueue_dirty(const JoltObjectImpl3D& p_object);
+
+	void enqueue_call_queries(const JoltAreaImpl3D& p_area);
+
+	void enqueue_shape_changed(const JoltShapedObjectImpl3D& p_object);
+
 #ifdef GDJ_CONFIG_EDITOR
 	void dump_debug_snapshot(const String& p_dir);
 
@@ -97,13 +159,22 @@ private:
 
 	void _post_step(float p_step);
 
+	void _collect_step_bodies();
+
+	int32_t _get_chunk_count(int32_t p_body_count) const;
+
+	void _update_collision_steps();
+
 	JoltBodyWriter3D body_accessor;
 
 	RID rid;
 
-	JPH::JobSystem* job_system = nullptr;
+	JoltJobSystem* job_system = nullptr;
 
-	JPH::TempAllocator* temp_allocator = nullptr;
+	JoltTempAllocatorPool* temp_allocator_pool = nullptr;
+
+	// Only set while stepping, since it's borrowed from the pool
+	JoltTempAllocator* temp_allocator = nullptr;
 
 	JoltLayerMapper* layer_mapper = nullptr;
 
@@ -115,7 +186,77 @@ private:
 
 	JoltAreaImpl3D* default_area = nullptr;
 
+	LocalVector<LocalVector<JoltShapedObjectImpl3D*>> listeners_by_chunk;
+
+	LocalVector<JPH::BodyID> pending_body_ids;
+
+	LocalVector<JPH::BodyID> step_body_ids;
+
+	LocalVector<JPH::BodyID> dirty_body_ids;
+
+	LocalVector<JPH::BodyID> queried_area_ids;
+
+	LocalVector<JPH::BodyID> querying_area_ids;
+
+	LocalVector<float> max_speed_by_chunk;
+
 	float last_step = 0.0f;
 
+	float max_step_speed = 0.0f;
+
+	float max_step_penetration = 0.0f;
+
+	float adaptive_velocity_threshold = 20.0f;
+
+	float adaptive_penetration_threshold = 0.05f;
+
+	int32_t collision_steps = 1;
+
+	int32_t max_collision_steps = 4;
+
+	int32_t pending_collision_steps = 1;
+
+	int32_t bulk_add_depth = 0;
+
+	int32_t bodies_added_since_optimization = 0;
+
+	int32_t bodies_removed_since_optimization = 0;
+
+	int32_t steps_since_optimization = 0;
+
+	int64_t optimization_count = 0;
+
+	int64_t last_optimization_usec = 0;
+
+	int64_t total_optimization_usec = 0;
+
+	std::atomic<int32_t> last_body_count = 0;
+
+	std::atomic<int32_t> last_active_body_count = 0;
+
+	std::atomic<int32_t> last_contact_manifold_count = 0;
+
+	int64_t last_temp_memory_peak = 0;
+
+	int64_t temp_memory_peak = 0;
+
+	int64_t manifold_cache_full_count = 0;
+
+	int64_t body_pair_cache_full_count = 0;
+
+	int64_t contact_constraints_full_count = 0;
+
+	int64_t pre_step_usec = 0;
+
+	int64_t update_usec = 0;
+
+	int64_t post_step_usec = 0;
+
+	int64_t call_queries_usec = 0;
+
+	bool adaptive_collision_steps = false;
+
 	bool has_stepped = false;
+
+	bool stepping = false;
 };
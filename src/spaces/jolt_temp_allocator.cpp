@@ -3,11 +3,14 @@
 #include "servers/jolt_project_settings.hpp"
 
 JoltTempAllocator::JoltTempAllocator()
-	: capacity((uint64_t)JoltProjectSettings::get_max_temp_memory_b())
-	, base(static_cast<uint8_t*>(JPH::Allocate((size_t)capacity))) { }
+	: chunk_size((uint64_t)JoltProjectSettings::get_max_temp_memory_b()) {
+	chunks.push_back(_allocate_chunk(chunk_size));
+}
 
 JoltTempAllocator::~JoltTempAllocator() {
-	JPH::Free(base);
+	for (Chunk& chunk : chunks) {
+		_free_chunk(chunk);
+	}
 }
 
 void* JoltTempAllocator::Allocate(uint32_t p_size) {
@@ -17,24 +20,28 @@ void* JoltTempAllocator::Allocate(uint32_t p_size) {
 
 	p_size = align_up(p_size, 16U);
 
-	const uint64_t new_top = top + p_size;
-
-	void* ptr = nullptr;
+	if (chunks[current_chunk].top + p_size > chunks[current_chunk].size) {
+		current_chunk++;
 
-	if (new_top <= capacity) {
-		ptr = base + top;
-	} else {
-		WARN_PRINT_ONCE(vformat(
-			"Godot Jolt's temporary memory allocator exceeded capacity of %d MiB. "
-			"Falling back to slower general-purpose allocator. "
-			"Consider increasing maximum temporary memory in project settings.",
-			JoltProjectSettings::get_max_temp_memory_mib()
-		));
+		if (current_chunk == (int32_t)chunks.size()) {
+			chunks.push_back(_allocate_chunk(MAX(chunk_size, (uint64_t)p_size)));
+		} else if (chunks[current_chunk].size < p_size) {
+			// Chunks past the current one are always empty, so we can just replace it
+			_free_chunk(chunks[current_chunk]);
+			chunks[current_chunk] = _allocate_chunk(p_size);
+		}
 
-		ptr = JPH::Allocate(p_size);
+		step_last_chunk = MAX(step_last_chunk, current_chunk);
 	}
 
-	top = new_top;
+	Chunk& chunk = chunks[current_chunk];
+
+	void* ptr = chunk.base + chunk.top;
+
+	chunk.top += p_size;
+
+	usage += p_size;
+	step_peak_usage = MAX(step_peak_usage, usage);
 
 	return ptr;
 }
@@ -46,15 +53,84 @@ void JoltTempAllocator::Free(void* p_ptr, uint32_t p_size) {
 
 	p_size = align_up(p_size, 16U);
 
-	const uint64_t new_top = top - p_size;
+	Chunk& chunk = chunks[current_chunk];
 
-	if (top <= capacity) {
-		if (base + new_top != p_ptr) {
-			CRASH_NOW_MSG("Temporary memory was freed in the wrong order.");
-		}
+	if (chunk.top < p_size || chunk.base + chunk.top - p_size != p_ptr) {
+		CRASH_NOW_MSG("Temporary memory was freed in the wrong order.");
+	}
+
+	chunk.top -= p_size;
+
+	usage -= p_size;
+
+	if (chunk.top == 0 && current_chunk > 0) {
+		current_chunk--;
+	}
+}
+
+void JoltTempAllocator::post_step() {
+	last_step_peak_usage = step_peak_usage;
+	peak_usage = MAX(peak_usage, step_peak_usage);
+	step_peak_usage = usage;
+
+	tick_needed_chunks |= step_last_chunk > 0;
+
+	step_last_chunk = current_chunk;
+}
+
+void JoltTempAllocator::post_tick() {
+	_update_trim(tick_needed_chunks);
+
+	tick_needed_chunks = false;
+}
+
+JoltTempAllocator::Chunk JoltTempAllocator::_allocate_chunk(uint64_t p_size) {
+	Chunk chunk;
+	chunk.size = p_size;
+
+	if (JoltProjectSettings::use_huge_pages()) {
+		chunk.base = static_cast<uint8_t*>(allocate_huge_pages((size_t)p_size, chunk.mapped_size));
+	}
+
+	if (chunk.base == nullptr) {
+		chunk.base = static_cast<uint8_t*>(JPH::Allocate((size_t)p_size));
+	}
+
+	capacity += p_size;
+
+	return chunk;
+}
+
+void JoltTempAllocator::_free_chunk(Chunk& p_chunk) {
+	if (p_chunk.mapped_size > 0) {
+		free_huge_pages(p_chunk.base, p_chunk.mapped_size);
 	} else {
-		JPH::Free(p_ptr);
+		JPH::Free(p_chunk.base);
 	}
 
-	top = new_top;
+	capacity -= p_chunk.size;
+
+	p_chunk = {};
+}
+
+void JoltTempAllocator::_update_trim(bool p_needed_chunks) {
+	const int32_t trim_delay = JoltProjectSettings::get_temp_memory_trim_delay();
+
+	if (p_needed_chunks || trim_delay <= 0) {
+		quiet_ticks = 0;
+	} else if (chunks.size() > 1 && ++quiet_ticks >= trim_delay) {
+		_trim();
+	}
+}
+
+void JoltTempAllocator::_trim() {
+	ERR_FAIL_COND(usage > 0);
+
+	for (int32_t i = 1; i < (int32_t)chunks.size(); ++i) {
+		_free_chunk(chunks[i]);
+	}
+
+	chunks.resize(1);
+
+	quiet_ticks = 0;
 }
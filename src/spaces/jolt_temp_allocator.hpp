@@ -1,6 +1,20 @@
 #pragma once
 
+// Stack allocator for the temporary allocations made during a physics step, which starts out with
+// a single chunk of memory and adds more chunks whenever that runs out. Any additional chunks are
+// kept around for subsequent steps, until enough physics ticks have gone by without needing them.
 class JoltTempAllocator final : public JPH::TempAllocator {
+	struct Chunk {
+		uint8_t* base = nullptr;
+
+		uint64_t size = 0;
+
+		uint64_t top = 0;
+
+		// Only non-zero when the chunk was mapped directly, rather than allocated through Jolt
+		size_t mapped_size = 0;
+	};
+
 public:
 	explicit JoltTempAllocator();
 
@@ -10,10 +24,50 @@ public:
 
 	void Free(void* p_ptr, uint32_t p_size) override;
 
+	void post_step();
+
+	// Must be called once per physics tick, regardless of how many spaces were stepped with this
+	// allocator, if any, since the trim delay is counted in ticks rather than steps.
+	void post_tick();
+
+	uint64_t get_capacity() const { return capacity; }
+
+	int32_t get_chunk_count() const { return (int32_t)chunks.size(); }
+
+	// Returns the most memory that has been in use at any one time
+	uint64_t get_peak_usage() const { return peak_usage; }
+
+	// Returns the most memory that was in use at any one time during the last step
+	uint64_t get_last_step_peak_usage() const { return last_step_peak_usage; }
+
 private:
+	Chunk _allocate_chunk(uint64_t p_size);
+
+	void _free_chunk(Chunk& p_chunk);
+
+	void _update_trim(bool p_needed_chunks);
+
+	void _trim();
+
+	LocalVector<Chunk> chunks;
+
+	uint64_t chunk_size = 0;
+
 	uint64_t capacity = 0;
 
-	uint64_t top = 0;
+	uint64_t usage = 0;
+
+	uint64_t step_peak_usage = 0;
+
+	uint64_t last_step_peak_usage = 0;
+
+	uint64_t peak_usage = 0;
+
+	int32_t current_chunk = 0;
+
+	int32_t step_last_chunk = 0;
+
+	int32_t quiet_ticks = 0;
 
-	uint8_t* base = nullptr;
+	bool tick_needed_chunks = false;
 };
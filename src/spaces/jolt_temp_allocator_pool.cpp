@@ -0,0 +1,72 @@
+#include "jolt_temp_allocator_pool.hpp"
+
+#include "spaces/jolt_temp_allocator.hpp"
+
+JoltTempAllocatorPool::~JoltTempAllocatorPool() {
+	ERR_FAIL_COND_MSG(
+		available.size() != allocators.size(),
+		"Temporary allocator pool was destroyed while some of its allocators were still in use. "
+		"This should not happen."
+	);
+
+	for (JoltTempAllocator* allocator : allocators) {
+		delete_safely(allocator);
+	}
+}
+
+JoltTempAllocator* JoltTempAllocatorPool::acquire() {
+	const MutexLock lock(mutex);
+
+	if (available.is_empty()) {
+		auto* allocator = new JoltTempAllocator();
+		allocators.push_back(allocator);
+		return allocator;
+	}
+
+	// We hand out the most recently released allocator first, so that the others get to sit unused
+	// for long enough to have their additional chunks trimmed.
+	JoltTempAllocator* allocator = available[available.size() - 1];
+	available.remove_at(available.size() - 1);
+
+	return allocator;
+}
+
+void JoltTempAllocatorPool::release(JoltTempAllocator* p_allocator) {
+	ERR_FAIL_NULL(p_allocator);
+
+	const MutexLock lock(mutex);
+
+	available.push_back(p_allocator);
+}
+
+void JoltTempAllocatorPool::post_step() {
+	const MutexLock lock(mutex);
+
+	// We tick every allocator here, rather than as they're released, since the same allocator can
+	// be used by several spaces in a single tick, and others might not be used at all.
+	for (JoltTempAllocator* allocator : allocators) {
+		allocator->post_tick();
+	}
+}
+
+Dictionary JoltTempAllocatorPool::get_stats() const {
+	const MutexLock lock(mutex);
+
+	uint64_t capacity = 0;
+	uint64_t peak_usage = 0;
+	int32_t chunk_count = 0;
+
+	for (const JoltTempAllocator* allocator : allocators) {
+		capacity += allocator->get_capacity();
+		peak_usage = MAX(peak_usage, allocator->get_peak_usage());
+		chunk_count += allocator->get_chunk_count();
+	}
+
+	Dictionary stats;
+	stats["allocator_count"] = (int32_t)allocators.size();
+	stats["capacity"] = (int64_t)capacity;
+	stats["chunk_count"] = chunk_count;
+	stats["peak_usage"] = (int64_t)peak_usage;
+
+	return stats;
+}
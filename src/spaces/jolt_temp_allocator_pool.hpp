@@ -0,0 +1,42 @@
+#pragma once
+
+class JoltTempAllocator;
+
+// Hands out temporary allocators to physics spaces for the duration of their step, which means we
+// only ever need as many allocators as there are spaces being stepped at the same time, rather than
+// one for every space that exists.
+class JoltTempAllocatorPool final {
+	using Mutex = std::mutex;
+
+	using MutexLock = std::unique_lock<Mutex>;
+
+public:
+	JoltTempAllocatorPool() = default;
+
+	JoltTempAllocatorPool(const JoltTempAllocatorPool& p_other) = delete;
+
+	JoltTempAllocatorPool(JoltTempAllocatorPool&& p_other) = delete;
+
+	~JoltTempAllocatorPool();
+
+	JoltTempAllocator* acquire();
+
+	void release(JoltTempAllocator* p_allocator);
+
+	// Must be called once per physics tick, and not while any allocator is acquired
+	void post_step();
+
+	// Must not be called while any allocator is acquired
+	Dictionary get_stats() const;
+
+	JoltTempAllocatorPool& operator=(const JoltTempAllocatorPool& p_other) = delete;
+
+	JoltTempAllocatorPool& operator=(JoltTempAllocatorPool&& p_other) = delete;
+
+private:
+	LocalVector<JoltTempAllocator*> allocators;
+
+	LocalVector<JoltTempAllocator*> available;
+
+	mutable Mutex mutex;
+};